@@ -0,0 +1,255 @@
+#include "AssetCooker.h"
+
+#include "Engine/src/core/assets/AssetLoader.h"
+#include "Engine/src/core/assets/AssetPack.h"
+#include "Engine/src/core/assets/CompressedImage.h"
+#include "Engine/src/core/assets/CookedAssets.h"
+#include "Engine/src/core/assets/Font.h"
+#include "Engine/src/core/assets/ModelLoader.h"
+#include "Engine/src/core/assets/RawAudio.h"
+#include "Engine/src/core/assets/RawImage.h"
+#include "Engine/src/core/utils/Logger.h"
+#include "Engine/src/core/utils/STDExtensions.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+using namespace ChaosEngine;
+
+namespace Cooker {
+
+    static constexpr const char *cacheFileName = ".cookcache";
+
+    /* 2x2 box filter, odd sizes repeat the last row/column. */
+    static std::vector<char> downsampleRGBA(const std::vector<char> &source, uint32_t width, uint32_t height) {
+        const uint32_t newWidth = std::max(1u, width / 2);
+        const uint32_t newHeight = std::max(1u, height / 2);
+        const auto *src = reinterpret_cast<const uint8_t *>(source.data());
+        std::vector<char> result(static_cast<size_t>(newWidth) * newHeight * 4);
+        auto *dst = reinterpret_cast<uint8_t *>(result.data());
+        for (uint32_t y = 0; y < newHeight; ++y) {
+            const uint32_t y0 = std::min(2 * y, height - 1);
+            const uint32_t y1 = std::min(2 * y + 1, height - 1);
+            for (uint32_t x = 0; x < newWidth; ++x) {
+                const uint32_t x0 = std::min(2 * x, width - 1);
+                const uint32_t x1 = std::min(2 * x + 1, width - 1);
+                for (uint32_t c = 0; c < 4; ++c) {
+                    const uint32_t sum = src[(y0 * width + x0) * 4 + c] + src[(y0 * width + x1) * 4 + c] +
+                                         src[(y1 * width + x0) * 4 + c] + src[(y1 * width + x1) * 4 + c];
+                    dst[(y * newWidth + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+        return result;
+    }
+
+    AssetCooker::AssetCooker(CookOptions pOptions) : options(std::move(pOptions)) {
+        if (FT_Init_FreeType(&freetype)) {
+            throw std::runtime_error("ERROR::FREETYPE: Could not init FreeType Library");
+        }
+    }
+
+    AssetCooker::~AssetCooker() {
+        FT_Done_FreeType(freetype);
+    }
+
+    uint32_t AssetCooker::run() {
+        if (!fs::is_directory(options.sourceRoot))
+            throw std::runtime_error("[AssetCooker] Source directory does not exist: " + options.sourceRoot.string());
+        fs::create_directories(options.outputRoot);
+        const auto cacheFile = options.outputRoot / cacheFileName;
+        if (!options.force)
+            cache = CookCache::Load(cacheFile);
+
+        std::unordered_set<std::string> seenSources;
+        std::vector<std::string> staleOutputs;
+        uint32_t cookedCount = 0, upToDateCount = 0, failedCount = 0;
+        for (const auto &entry: fs::recursive_directory_iterator(options.sourceRoot)) {
+            if (!entry.is_regular_file())
+                continue;
+            const auto type = getAssetType(entry.path());
+            if (type == AssetType::None)
+                continue;
+
+            const auto relativePath = fs::relative(entry.path(), options.sourceRoot).generic_string();
+            seenSources.insert(relativePath);
+            try {
+                const uint64_t hash = hashInputs(type, entry.path());
+                if (cache.isUpToDate(relativePath, hash, options.outputRoot)) {
+                    ++upToDateCount;
+                    continue;
+                }
+                LOG_INFO("[AssetCooker] Cooking {}", relativePath);
+                const auto replacedOutputs = cache.update(relativePath, hash, cook(type, relativePath));
+                staleOutputs.insert(staleOutputs.end(), replacedOutputs.begin(), replacedOutputs.end());
+                ++cookedCount;
+            } catch (const std::exception &e) {
+                LOG_ERROR("[AssetCooker] Failed to cook {}: {}", relativePath, e.what());
+                // The outputs of the previous version would be served for the changed source, the runtime falls back
+                // to the source instead. The hash 0 does not match the source, so the next run tries again
+                const auto failedOutputs = cache.update(relativePath, 0, {});
+                staleOutputs.insert(staleOutputs.end(), failedOutputs.begin(), failedOutputs.end());
+                ++failedCount;
+            }
+        }
+
+        // Outputs of deleted sources, or ones a source no longer produces like a removed font size, would otherwise
+        // still be preferred by the runtime
+        const auto prunedOutputs = cache.prune(seenSources);
+        staleOutputs.insert(staleOutputs.end(), prunedOutputs.begin(), prunedOutputs.end());
+        for (const auto &output: staleOutputs) {
+            LOG_INFO("[AssetCooker] Removing stale output {}", output);
+            fs::remove(options.outputRoot / output);
+        }
+        cache.save(cacheFile);
+
+        if (options.packFile && (cookedCount > 0 || !staleOutputs.empty() || !fs::exists(*options.packFile)))
+            writePack();
+
+        LOG_INFO("[AssetCooker] {} cooked, {} up to date, {} failed", cookedCount, upToDateCount, failedCount);
+        return failedCount;
+    }
+
+    AssetCooker::AssetType AssetCooker::getAssetType(const fs::path &file) {
+        const auto extension = stringToLower(file.extension().string());
+        if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" ||
+            extension == ".bmp")
+            return AssetType::Texture;
+        if (extension == ".obj" || extension == ".ply")
+            return AssetType::Mesh;
+        if (extension == ".ogg")
+            return AssetType::Audio;
+        if (extension == ".ttf" || extension == ".otf")
+            return AssetType::Font;
+        return AssetType::None;
+    }
+
+    std::vector<fs::path> AssetCooker::getDependencies(AssetType type, const fs::path &source) {
+        std::vector<fs::path> dependencies;
+        if (type != AssetType::Mesh || stringToLower(source.extension().string()) != ".obj")
+            return dependencies;
+
+        std::ifstream input(source);
+        std::string line;
+        while (std::getline(input, line)) {
+            if (line.rfind("mtllib ", 0) != 0)
+                continue;
+            auto library = line.substr(7);
+            library.erase(library.find_last_not_of(" \t\r") + 1);
+            dependencies.emplace_back(source.parent_path() / library);
+        }
+        return dependencies;
+    }
+
+    uint64_t AssetCooker::hashInputs(AssetType type, const fs::path &source) const {
+        uint64_t hash = CookCache::hash(&CookedAssets::formatVersion, sizeof(CookedAssets::formatVersion));
+        if (type == AssetType::Font) {
+            hash = CookCache::hash(options.fontSizes.data(), options.fontSizes.size() * sizeof(FontSize), hash);
+        }
+        hash = CookCache::hashFile(source, hash);
+        for (const auto &dependency: getDependencies(type, source)) {
+            // A missing dependency is part of the state as well
+            hash = fs::exists(dependency) ? CookCache::hashFile(dependency, hash) : CookCache::hash("", 1, hash);
+        }
+        return hash;
+    }
+
+    std::vector<std::string> AssetCooker::cook(AssetType type, const std::string &relativePath) {
+        switch (type) {
+            case AssetType::Texture:
+                return cookTexture(relativePath);
+            case AssetType::Mesh:
+                return cookMesh(relativePath);
+            case AssetType::Audio:
+                return cookAudio(relativePath);
+            case AssetType::Font:
+                return cookFont(relativePath);
+            default:
+                return {};
+        }
+    }
+
+    // ------------------------------------ Cookers --------------------------------------------------------------------
+
+    std::vector<std::string> AssetCooker::cookTexture(const std::string &relativePath) {
+        const auto decoded = RawImage::decodeImage((options.sourceRoot / relativePath).string(),
+                                                   ImageFormat::R8G8B8A8);
+        uint32_t width = decoded.getWidth();
+        uint32_t height = decoded.getHeight();
+
+        std::vector<std::vector<char>> levels;
+        levels.emplace_back(decoded.getSize());
+        decoded.convertInto(levels.back().data());
+        while (width > 1 || height > 1) {
+            levels.emplace_back(downsampleRGBA(levels.back(), width, height));
+            width = std::max(1u, width / 2);
+            height = std::max(1u, height / 2);
+        }
+
+        const auto output = CookedAssets::getTexturePath(relativePath);
+        writeOutput(output, CompressedImage::writeKTX2(ImageFormat::R8G8B8A8, decoded.getWidth(),
+                                                       decoded.getHeight(), levels));
+        return {output};
+    }
+
+    std::vector<std::string> AssetCooker::cookMesh(const std::string &relativePath) {
+        const auto source = (options.sourceRoot / relativePath).string();
+        const bool isPLY = stringToLower(fs::path(relativePath).extension().string()) == ".ply";
+        const auto mesh = isPLY ? ModelLoader::loadMeshFromPLY(source) : ModelLoader::loadMeshFromOBJ(source);
+        if (!mesh)
+            throw std::runtime_error("Failed to load mesh");
+
+        const auto output = CookedAssets::getMeshPath(relativePath);
+        writeOutput(output, ModelLoader::writeCookedMesh(MeshOptimizer::optimize(**mesh, MeshOptimizer::Options{})));
+        return {output};
+    }
+
+    std::vector<std::string> AssetCooker::cookAudio(const std::string &relativePath) {
+        const auto audio = RawAudio::loadOggFile((options.sourceRoot / relativePath).string());
+
+        const auto output = CookedAssets::getAudioPath(relativePath);
+        writeOutput(output, audio.writeCooked());
+        return {output};
+    }
+
+    std::vector<std::string> AssetCooker::cookFont(const std::string &relativePath) {
+        std::vector<std::string> outputs;
+        for (const auto &fontSize: options.fontSizes) {
+            const auto atlas = Font::Rasterize(freetype, (options.sourceRoot / relativePath).string(), fontSize.size,
+                                               fontSize.resolution);
+            const auto output = CookedAssets::getFontPath(relativePath, fontSize.size, fontSize.resolution);
+            writeOutput(output, Font::writeCookedAtlas(atlas));
+            outputs.emplace_back(output);
+        }
+        return outputs;
+    }
+
+    // ------------------------------------ Output ---------------------------------------------------------------------
+
+    void AssetCooker::writeOutput(const std::string &relativePath, const std::vector<char> &data) const {
+        const auto path = options.outputRoot / relativePath;
+        fs::create_directories(path.parent_path());
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        if (!output.is_open())
+            throw std::runtime_error("Failed to open output " + path.string());
+        output.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!output)
+            throw std::runtime_error("Failed to write output " + path.string());
+    }
+
+    void AssetCooker::writePack() const {
+        AssetPackWriter writer;
+        uint32_t entryCount = 0;
+        for (const auto &[source, record]: cache.getRecords()) {
+            for (const auto &output: record.outputs) {
+                writer.add(output, AssetLoader::loadBinary((options.outputRoot / output).string()));
+                ++entryCount;
+            }
+        }
+        writer.write(options.packFile->string());
+        LOG_INFO("[AssetCooker] Wrote {} entries to {}", entryCount, options.packFile->string());
+    }
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CookCache.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Cooker {
+
+    struct FontSize {
+        double size;
+        double resolution;
+    };
+
+    struct CookOptions {
+        std::filesystem::path sourceRoot;
+        std::filesystem::path outputRoot;
+        /// All cooked outputs are additionally packed into this file
+        std::optional<std::filesystem::path> packFile;
+        /// Font atlases are rasterized for every one of these sizes
+        std::vector<FontSize> fontSizes;
+        /// Ignore the cache and cook everything
+        bool force = false;
+    };
+
+    /**
+     * Converts the raw assets of a source tree into their runtime ready formats:
+     *  - Textures: R8G8B8A8 KTX2 files with a complete mip chain
+     *  - Meshes: Optimized vertex and index data including the LODs
+     *  - Audio: Decoded 16 bit PCM samples
+     *  - Fonts: Pre rasterized glyph atlases
+     * Outputs are written next to their source path inside the output root, see CookedAssets for the naming.
+     */
+    class AssetCooker {
+    public:
+        explicit AssetCooker(CookOptions options);
+
+        ~AssetCooker();
+
+        AssetCooker(const AssetCooker &o) = delete;
+
+        AssetCooker &operator=(const AssetCooker &o) = delete;
+
+        /// Cooks all changed assets and returns the number of assets which failed to cook
+        uint32_t run();
+
+    private:
+        enum class AssetType {
+            None, Texture, Mesh, Audio, Font
+        };
+
+        static AssetType getAssetType(const std::filesystem::path &file);
+
+        /// Additional input files which change the cooked result, e.g. the material library of an OBJ file
+        static std::vector<std::filesystem::path> getDependencies(AssetType type, const std::filesystem::path &source);
+
+        [[nodiscard]] uint64_t hashInputs(AssetType type, const std::filesystem::path &source) const;
+
+        /// Returns the written outputs relative to the output root
+        std::vector<std::string> cook(AssetType type, const std::string &relativePath);
+
+        std::vector<std::string> cookTexture(const std::string &relativePath);
+
+        std::vector<std::string> cookMesh(const std::string &relativePath);
+
+        std::vector<std::string> cookAudio(const std::string &relativePath);
+
+        std::vector<std::string> cookFont(const std::string &relativePath);
+
+        void writeOutput(const std::string &relativePath, const std::vector<char> &data) const;
+
+        void writePack() const;
+
+    private:
+        const CookOptions options;
+        CookCache cache;
+        FT_Library freetype = nullptr;
+    };
+
+}
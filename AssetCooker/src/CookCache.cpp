@@ -0,0 +1,109 @@
+#include "CookCache.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+namespace Cooker {
+
+    // Line format: <source>\t<hash>\t<output>\t<output>...
+    CookCache CookCache::Load(const fs::path &cacheFile) {
+        CookCache cache;
+        std::ifstream input(cacheFile);
+        if (!input.is_open())
+            return cache;
+
+        std::string line;
+        while (std::getline(input, line)) {
+            std::stringstream lineStream(line);
+            std::string source, hashString, output;
+            if (!std::getline(lineStream, source, '\t') || !std::getline(lineStream, hashString, '\t'))
+                continue;
+            Record record{std::strtoull(hashString.c_str(), nullptr, 16), {}};
+            while (std::getline(lineStream, output, '\t')) {
+                record.outputs.emplace_back(output);
+            }
+            cache.records.insert_or_assign(source, std::move(record));
+        }
+        return cache;
+    }
+
+    void CookCache::save(const fs::path &cacheFile) const {
+        std::ofstream output(cacheFile, std::ios::trunc);
+        if (!output.is_open())
+            throw std::runtime_error("[CookCache] Failed to write " + cacheFile.string());
+        for (const auto &[source, record]: records) {
+            output << source << '\t' << std::hex << record.hash << std::dec;
+            for (const auto &file: record.outputs) {
+                output << '\t' << file;
+            }
+            output << '\n';
+        }
+    }
+
+    bool CookCache::isUpToDate(const std::string &source, uint64_t hash, const fs::path &outputRoot) const {
+        const auto record = records.find(source);
+        if (record == records.end() || record->second.hash != hash)
+            return false;
+        for (const auto &file: record->second.outputs) {
+            if (!fs::exists(outputRoot / file))
+                return false;
+        }
+        return true;
+    }
+
+    std::vector<std::string>
+    CookCache::update(const std::string &source, uint64_t hash, std::vector<std::string> &&outputs) {
+        std::vector<std::string> staleOutputs;
+        const auto previous = records.find(source);
+        if (previous != records.end()) {
+            for (const auto &file: previous->second.outputs) {
+                if (std::find(outputs.begin(), outputs.end(), file) == outputs.end())
+                    staleOutputs.emplace_back(file);
+            }
+        }
+        records.insert_or_assign(source, Record{hash, std::move(outputs)});
+        return staleOutputs;
+    }
+
+    std::vector<std::string> CookCache::prune(const std::unordered_set<std::string> &seenSources) {
+        std::vector<std::string> staleOutputs;
+        for (auto it = records.begin(); it != records.end();) {
+            if (seenSources.contains(it->first)) {
+                ++it;
+                continue;
+            }
+            staleOutputs.insert(staleOutputs.end(), it->second.outputs.begin(), it->second.outputs.end());
+            it = records.erase(it);
+        }
+        return staleOutputs;
+    }
+
+    uint64_t CookCache::hash(const void *data, size_t size, uint64_t seed) {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        uint64_t hash = seed;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    uint64_t CookCache::hashFile(const fs::path &file, uint64_t seed) {
+        std::ifstream input(file, std::ios::binary);
+        if (!input.is_open())
+            throw std::runtime_error("[CookCache] Failed to read " + file.string());
+        uint64_t hash = seed;
+        char buffer[64 * 1024];
+        while (input) {
+            input.read(buffer, sizeof(buffer));
+            hash = CookCache::hash(buffer, static_cast<size_t>(input.gcount()), hash);
+        }
+        return hash;
+    }
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdint>
+
+namespace Cooker {
+
+    /**
+     * Remembers which inputs produced which cooked outputs, so only changed assets are cooked again.
+     * An asset is keyed by its path relative to the source root and identified by the hash over the contents of all its
+     * inputs and the cook settings. The cache is stored as a plain text file in the output directory.
+     */
+    class CookCache {
+    public:
+        struct Record {
+            uint64_t hash;
+            std::vector<std::string> outputs; // Relative to the output root
+        };
+
+    public:
+        CookCache() = default;
+
+        ~CookCache() = default;
+
+        /// A missing or unreadable cache file results in an empty cache
+        static CookCache Load(const std::filesystem::path &cacheFile);
+
+        void save(const std::filesystem::path &cacheFile) const;
+
+        /// Up to date if the hash did not change and all outputs still exist
+        [[nodiscard]] bool isUpToDate(const std::string &source, uint64_t hash,
+                                      const std::filesystem::path &outputRoot) const;
+
+        /// Replaces the record of a source and returns the outputs of the previous record which are no longer produced
+        std::vector<std::string> update(const std::string &source, uint64_t hash, std::vector<std::string> &&outputs);
+
+        /// Removes all records of sources which were not seen in this run and returns their outputs
+        std::vector<std::string> prune(const std::unordered_set<std::string> &seenSources);
+
+        [[nodiscard]] const std::unordered_map<std::string, Record> &getRecords() const { return records; }
+
+        // ------------------------------------ Hashing ----------------------------------------------------------------
+
+        static constexpr uint64_t hashSeed = 0xcbf29ce484222325ull;
+
+        /// FNV-1a, chainable through the seed
+        static uint64_t hash(const void *data, size_t size, uint64_t seed = hashSeed);
+
+        static uint64_t hashFile(const std::filesystem::path &file, uint64_t seed = hashSeed);
+
+    private:
+        std::unordered_map<std::string, Record> records;
+    };
+
+}
@@ -0,0 +1,54 @@
+#include "AssetCooker.h"
+
+#include "Engine/src/core/utils/Logger.h"
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+
+static void printUsage() {
+    std::cerr << "Usage: AssetCooker <source dir> <output dir> [options]\n"
+              << "  --pack <file>                Additionally pack all cooked outputs into <file>\n"
+              << "  --font <size>:<resolution>   Rasterize font atlases for this size, can be repeated\n"
+              << "  --force                      Ignore the cook cache and cook every asset\n";
+}
+
+static Cooker::FontSize parseFontSize(const std::string &argument) {
+    const auto separator = argument.find(':');
+    if (separator == std::string::npos)
+        throw std::invalid_argument("Font size needs to be given as <size>:<resolution>, got " + argument);
+    return Cooker::FontSize{std::stod(argument.substr(0, separator)), std::stod(argument.substr(separator + 1))};
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    try {
+        Logger::Init(LogLevel::Info);
+
+        Cooker::CookOptions options{.sourceRoot = argv[1], .outputRoot = argv[2]};
+        for (int i = 3; i < argc; ++i) {
+            const std::string argument = argv[i];
+            if (argument == "--pack" && i + 1 < argc) {
+                options.packFile = argv[++i];
+            } else if (argument == "--font" && i + 1 < argc) {
+                options.fontSizes.emplace_back(parseFontSize(argv[++i]));
+            } else if (argument == "--force") {
+                options.force = true;
+            } else {
+                printUsage();
+                return EXIT_FAILURE;
+            }
+        }
+
+        Cooker::AssetCooker cooker{std::move(options)};
+        return cooker.run() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    } catch (const std::exception &ex) {
+        std::cerr << "[FATAL] " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -15,6 +15,7 @@
 
 #include "core/audioSystem/api/AudioBuffer.h"
 #include "core/audioSystem/api/AudioSource.h"
+#include "core/audioSystem/api/AudioStream.h"
 
 // Rendering API --------------------------------------------------------------
 #include "renderer/api/GraphicsContext.h"
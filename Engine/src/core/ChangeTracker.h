@@ -0,0 +1,82 @@
+#pragma once
+
+#include <vector>
+
+#include <entt/entity/registry.hpp>
+
+namespace ChaosEngine {
+
+    /**
+     * Collects the entities whose components were added or changed since the last call of each or clear, so systems
+     * only need to process what changed.
+     * Changes are only seen if they go through the registry: emplace, emplace_or_replace, patch or replace (e.g.
+     * Entity::setComponent and Entity::patch). Writing through a reference from get is NOT tracked.
+     * Every consumer owns its tracker, the tracker MUST NOT outlive the registry and the registry MUST NOT be moved.
+     * Changes are recorded on the thread changing the component, so tracked components MUST only be changed on the
+     * main thread.
+     */
+    template<typename... Component>
+    class ChangeTracker {
+        static_assert(sizeof...(Component) > 0, "A change tracker needs at least one component");
+
+    public:
+        explicit ChangeTracker(entt::registry &registry) : registry(registry) {
+            (registry.template on_construct<Component>().template connect<&ChangeTracker::mark>(*this), ...);
+            (registry.template on_update<Component>().template connect<&ChangeTracker::mark>(*this), ...);
+        }
+
+        ~ChangeTracker() {
+            (registry.template on_construct<Component>().disconnect(this), ...);
+            (registry.template on_update<Component>().disconnect(this), ...);
+        }
+
+        ChangeTracker(const ChangeTracker &o) = delete;
+
+        ChangeTracker &operator=(const ChangeTracker &o) = delete;
+
+        ChangeTracker(ChangeTracker &&o) = delete;
+
+        ChangeTracker &operator=(ChangeTracker &&o) = delete;
+
+        /// Calls function(entity) once for every changed entity which still exists, then clears the changes
+        template<typename Function>
+        void each(Function &&function) {
+            for (auto entity: changed) {
+                if (registry.valid(entity))
+                    function(entity);
+            }
+            clear();
+        }
+
+        void clear() {
+            for (auto entity: changed) {
+                marked[entt::to_entity(entity)] = entt::null;
+            }
+            changed.clear();
+        }
+
+        /// Upper bound of the changed entities, destroyed entities are only skipped by each
+        [[nodiscard]] size_t size() const { return changed.size(); }
+
+        [[nodiscard]] bool empty() const { return changed.empty(); }
+
+    private:
+        void mark(entt::registry &, entt::entity entity) {
+            const auto index = entt::to_entity(entity);
+            if (index >= marked.size())
+                marked.resize(index + 1, entt::null);
+            // Compares the whole entity, a recycled index is a different entity
+            if (marked[index] == entity)
+                return;
+            marked[index] = entity;
+            changed.push_back(entity);
+        }
+
+    private:
+        entt::registry &registry;
+        std::vector<entt::entity> changed{};
+        // Changed entity by entity index, to record every entity only once
+        std::vector<entt::entity> marked{};
+    };
+
+}
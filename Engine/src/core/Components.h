@@ -11,7 +11,9 @@
 #include <glm/gtx/quaternion.hpp>
 #include <utility>
 #include <memory>
+#include <limits>
 
+#include "Engine/src/core/utils/GLMCustomExtension.h"
 #include "Engine/src/renderer/api/Material.h"
 #include "Engine/src/renderer/api/RenderMesh.h"
 #include "Engine/src/core/scriptSystem/NativeScript.h"
@@ -34,6 +36,48 @@ struct Transform {
         ret *= glm::toMat4(glm::quat({glm::radians(rotation.x), glm::radians(rotation.y), glm::radians(rotation.z)}));
         return glm::scale(ret, scale);;
     }
+
+    bool operator==(const Transform &o) const = default;
+};
+
+/**
+ * 2D model matrix computed from a transform, it is only recomputed once that transform changes.
+ * Rotations out of the plane only affect the projected x and y axes, the depth is the z position.
+ */
+struct ModelMatrixCache {
+    // NaN never compares equal, so the first update always computes the matrix
+    Transform source{glm::vec3(std::numeric_limits<float>::quiet_NaN()), glm::vec3(0), glm::vec3(0)};
+    GLMCustomExtension::Affine2D matrix{};
+};
+
+/// World matrix of the Transform, maintained by the TransformHierarchy
+struct WorldMatrixComponent : ModelMatrixCache {
+    uint32_t generation = 0; // Hierarchy update in which the matrix last changed
+};
+
+/**
+ * Makes the Transform of the entity relative to the parent, set through Entity::setParent. Replacing it directly on the
+ * registry would bypass the child links.
+ * Only rendering uses the world matrix, physics bodies, audio sources and UI elements read the Transform directly and
+ * belong on root entities.
+ */
+struct ParentComponent {
+    entt::entity parent;
+    uint32_t depth = 0; // Number of ancestors, maintained by the TransformHierarchy
+    // Other children of the parent, maintained by the ECS
+    entt::entity previousSibling = entt::null;
+    entt::entity nextSibling = entt::null;
+};
+
+/// First child of an entity with children, the others are linked through their ParentComponents. Maintained by the ECS.
+struct ChildrenComponent {
+    entt::entity first = entt::null;
+};
+
+/// Matrix of the Transform relative to the parent, maintained by the TransformHierarchy
+struct LocalMatrixComponent : ModelMatrixCache {
+    entt::entity parent = entt::null; // Parent the world matrix was last computed with
+    uint32_t generation = 0; // Hierarchy update in which the matrix last changed
 };
 
 struct RenderComponent {
@@ -107,6 +151,13 @@ struct UIRenderComponent {
     glm::vec3 scaleOffset;
 };
 
+/// Model matrices of UI elements and UI texts, maintained by the UIRenderSubSystem
+struct UIMatrixComponent : ModelMatrixCache {
+};
+
+struct UITextMatrixComponent : ModelMatrixCache {
+};
+
 // Physics components ---------------------------------------------------------------------
 
 struct StaticRigidBodyComponent {
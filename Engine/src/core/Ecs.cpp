@@ -1,3 +1,77 @@
 #include "Ecs.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "Components.h"
+
+using namespace ChaosEngine;
+
 const ChaosEngine::ECS::entity_t ChaosEngine::ECS::null = entt::null;
+
+// Prepends the new child to the child list of its parent
+static void linkToParent(entt::registry &registry, entt::entity entity) {
+    auto &link = registry.get<ParentComponent>(entity);
+    link.previousSibling = entt::null;
+    link.nextSibling = entt::null;
+    if (!registry.valid(link.parent))
+        return; // The TransformHierarchy removes it again
+    auto &children = registry.get_or_emplace<ChildrenComponent>(link.parent);
+    if (children.first != entt::null)
+        registry.get<ParentComponent>(children.first).previousSibling = entity;
+    link.nextSibling = children.first;
+    children.first = entity;
+}
+
+static void unlinkFromParent(entt::registry &registry, entt::entity entity) {
+    const auto &link = registry.get<ParentComponent>(entity);
+    if (link.previousSibling != entt::null) {
+        registry.get<ParentComponent>(link.previousSibling).nextSibling = link.nextSibling;
+    } else if (auto *children = registry.try_get<ChildrenComponent>(link.parent);
+            children != nullptr && children->first == entity) {
+        children->first = link.nextSibling;
+    }
+    if (link.nextSibling != entt::null)
+        registry.get<ParentComponent>(link.nextSibling).previousSibling = link.previousSibling;
+}
+
+ECS::ECS() : registry() {
+    registry.on_construct<ParentComponent>().connect<&linkToParent>();
+    registry.on_destroy<ParentComponent>().connect<&unlinkFromParent>();
+}
+
+void ECS::removeEntities(const std::vector<entity_t> &entities) {
+    std::vector<entity_t> removed;
+    for (auto entity: entities) {
+        if (!registry.valid(entity))
+            continue;
+        removed.push_back(entity);
+        collectDescendants(entity, removed);
+    }
+    // An entity may be listed together with one of its ancestors
+    std::sort(removed.begin(), removed.end());
+    removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+    registry.destroy(removed.begin(), removed.end());
+}
+
+void ECS::removeDescendants(entity_t entity) {
+    std::vector<entity_t> descendants;
+    collectDescendants(entity, descendants);
+    registry.destroy(descendants.begin(), descendants.end());
+}
+
+void ECS::collectDescendants(entity_t entity, std::vector<entity_t> &descendants) const {
+    // Breadth first, the appended descendants are the queue of parents still to visit
+    size_t next = descendants.size();
+    for (auto parent = entity;;) {
+        if (const auto *children = registry.try_get<ChildrenComponent>(parent)) {
+            for (auto child = children->first; child != entt::null;
+                 child = registry.get<ParentComponent>(child).nextSibling) {
+                descendants.push_back(child);
+            }
+        }
+        if (next == descendants.size())
+            return;
+        parent = descendants[next++];
+    }
+}
@@ -3,19 +3,23 @@
 #include <stdexcept>
 #include <entt/entity/registry.hpp>
 #include <string>
+#include <vector>
 #include "Entity.h"
+#include "EntityCommandBuffer.h"
+#include "ParallelView.h"
+#include "ChangeTracker.h"
 
 namespace ChaosEngine {
 
     /**
-     * Thin handle to the entity registry.
+     * Thin handle to the entity registry, the command buffer for deferred structural changes and parallel loops.
      */
     class ECS {
     public:
         using entity_t = entt::entity;
 
     public:
-        ECS() : registry() {}
+        ECS();
 
         ~ECS() = default;
 
@@ -35,18 +39,34 @@ namespace ChaosEngine {
         /// Add a new entity to this registry
         inline Entity addEntity() { return Entity{&registry, registry.create()}; };
 
-        /// Remove an entity from this registry
-        inline void removeEntity(entity_t entity) { registry.destroy(entity); };
+        /// Add count entities at once, each with a copy of the components
+        template<typename... Component>
+        std::vector<entity_t> addEntities(size_t count, const Component &... components) {
+            std::vector<entity_t> entities(count);
+            registry.create(entities.begin(), entities.end());
+            (registry.insert<Component>(entities.begin(), entities.end(), components), ...);
+            return entities;
+        }
+
+        /// Remove an entity and all of its descendants from this registry
+        inline void removeEntity(entity_t entity) {
+            removeDescendants(entity);
+            registry.destroy(entity);
+        };
 
-        /// Remove an entity from this registry
+        /// Remove an entity and all of its descendants from this registry
         inline void removeEntity(Entity entity) {
             if (!registry.valid(entity.entity)) {
                 throw std::runtime_error(std::string("Tried to remove invalid entity") +
                                          std::to_string(static_cast<std::underlying_type<entt::entity>::type>(entity)));
             }
+            removeDescendants(entity.entity);
             registry.destroy(entity.entity);
         };
 
+        /// Remove the entities and all of their descendants from this registry, invalid entities are skipped
+        void removeEntities(const std::vector<entity_t> &entities);
+
         /// Get an existing entity handle from this registry
         inline Entity getEntity(entity_t entity) {
             if (!registry.valid(entity)) {
@@ -56,12 +76,52 @@ namespace ChaosEngine {
             return Entity{&registry, entity};
         };
 
+        /// Handle of an entity which was destroyed, it is null but still converts to the id the entity had
+        inline static Entity getDestroyedEntity(entity_t entity) { return Entity{nullptr, entity}; }
+
         /// Access the internal registry
         inline entt::registry &getRegistry() { return registry; }
 
         /// Const-Access to the internal registry
         inline const entt::registry &getRegistry() const { return registry; }
 
+        /// Structural changes recorded here are applied at the next sync point
+        inline EntityCommandBuffer &getCommandBuffer() { return commandBuffer; }
+
+        /// Applies all recorded structural changes, MUST only be called while no system iterates over the registry
+        inline void applyCommands() { commandBuffer.apply(*this); }
+
+        /**
+         * Parallel loop over all entities with the components on the workers, const components are only read.
+         * Conflicting access of loops running at the same time is checked in debug builds.
+         */
+        template<typename... Component>
+        inline ParallelView<Component...> parallelView(WorkerPool &workers) {
+            return ParallelView<Component...>(registry, workers, componentAccess);
+        }
+
+        /**
+         * Parallel loop over all entities with the components, which are owned by a group and kept packed in matching
+         * order, for hot loops over many entities. Adding or removing owned components becomes more expensive and a
+         * component can only be owned by one group, so only the hottest combinations should be grouped.
+         */
+        template<typename... Component>
+        inline ParallelView<Component...> parallelGroup(WorkerPool &workers) {
+            return ParallelView<Component...>(registry, workers, componentAccess,
+                                              typename ParallelView<Component...>::OwningGroup{});
+        }
+
+        inline ComponentAccess &getComponentAccess() { return componentAccess; }
+
+        /**
+         * Tracks the entities whose components are added or changed from now on, mutations MUST go through
+         * Entity::setComponent, Entity::patch or Entity::replace to be seen.
+         */
+        template<typename... Component>
+        inline std::unique_ptr<ChangeTracker<Component...>> trackChanges() {
+            return std::make_unique<ChangeTracker<Component...>>(registry);
+        }
+
     public:
         static const entity_t null;
 
@@ -69,8 +129,16 @@ namespace ChaosEngine {
             return entt::to_integral(entity);
         }
 
+    private:
+        void removeDescendants(entity_t entity);
+
+        /// Appends all descendants of the entity to the list, walking only the child links of the subtree
+        void collectDescendants(entity_t entity, std::vector<entity_t> &descendants) const;
+
     private:
         entt::registry registry;
+        EntityCommandBuffer commandBuffer;
+        ComponentAccess componentAccess;
     };
 
 }
@@ -4,18 +4,22 @@
 
 #include "Scene.h"
 #include "core/utils/Logger.h"
+#include "core/assets/AssetLoader.h"
+
+#include <filesystem>
 
 using namespace ChaosEngine;
 
 Engine *ChaosEngine::Engine::s_engineInstance = nullptr;
 
 Engine::Engine()
-        : window(Window::Create("Chaos Engine", 1400, 800)),
-          renderingSys(window, Renderer::GraphicsAPI::Vulkan),
-          uiSystem(renderingSys, window),
-          nativeScriptSystem(),
-          physicsSystem(),
-          audioSystem(),
+        : workerPool(),
+          window(Window::Create("Chaos Engine", 1400, 800)),
+          renderingSys(window, Renderer::GraphicsAPI::Vulkan, workerPool),
+          uiSystem(renderingSys, window, workerPool),
+          nativeScriptSystem(workerPool),
+          physicsSystem(workerPool),
+          audioSystem(workerPool),
           assetManager(std::make_shared<AssetManager>()),
           scene(nullptr),
           debugRenderingEnabled(false),
@@ -26,25 +30,45 @@ Engine::Engine()
         throw std::runtime_error("There can only be one running Engine instance!");
     }
     s_engineInstance = this;
+    if (std::filesystem::exists(assetPackFile))
+        AssetLoader::mountPack(assetPackFile);
     Logger::I("Engine", "Loading Scene");
 }
 
+Engine::~Engine() {
+    // The scene is destroyed before the systems, suspended coroutines may still refer to it
+    if (scene != nullptr) {
+        nativeScriptSystem.getScheduler().clear();
+        physicsSystem.unload();
+    }
+}
+
 void Engine::loadScene(std::unique_ptr<Scene> &&pScene) {
     assert("A Scene is required." && pScene != nullptr);
+    if (scene != nullptr) {
+        // Coroutines of the old scene are destroyed while the scene still exists
+        nativeScriptSystem.getScheduler().clear();
+        physicsSystem.unload();
+    }
     scene = std::move(pScene);
     SceneConfiguration config = scene->configure(*this);
     debugRenderingEnabled = config.debugRenderingEnabled;
 
     renderingSys.createRenderer(config.rendererType, config.renderSceneToOffscreenBuffer, debugRenderingEnabled);
     physicsSystem.init(*scene);
-    audioSystem.init(*scene);
+    audioSystem.init(*scene, config.audioBackend);
 
     scene->load();
 
-    nativeScriptSystem.init(scene->ecs);
+    nativeScriptSystem.init(*scene);
     uiSystem.init(scene->ecs);
 }
 
+EntityCommandBuffer &Engine::getCommandBuffer() {
+    assert("A Scene is required." && scene != nullptr);
+    return scene->ecs.getCommandBuffer();
+}
+
 void Engine::run() {
     assert("A Scene is required for the engine to run!" && scene != nullptr);
     while (!window.shouldClose()) {
@@ -63,10 +87,12 @@ void Engine::run() {
         // Get window events
         window.poolEvents();
 
-        // TOBE: Apply all changes to components
+        // Sync point: Apply structural changes recorded by the scene and the ImGui interface
+        scene->ecs.applyCommands();
         renderingSys.updateComponents(scene->ecs);
+        // Keep the texture memory within budget before anything is recorded
+        assetManager->getTextureStreamer().update(RenderingSystem::GetContext());
         // --------------------------------------------------------------------
-        // TOBE Syncpoint
 
         // Update all Systems -------------------------------------------------
         // Update ImGui
@@ -85,9 +111,11 @@ void Engine::run() {
             renderingSys.renderEntities(scene->ecs, std::nullopt);
 
         // Run all script updates
-        nativeScriptSystem.update(scene->ecs, deltaTime);
+        nativeScriptSystem.update(*scene, deltaTime);
         // Tick rendering system
         physicsSystem.update(scene->ecs, deltaTime);
+        // Sync point: Apply structural changes recorded by scripts and collision callbacks
+        scene->ecs.applyCommands();
         // Tick audio system
         audioSystem.update(scene->ecs, deltaTime);
 
@@ -9,6 +9,7 @@
 #include "Engine/src/core/uiSystem/UISystem.h"
 #include "Engine/src/core/physicsSystem/PhysicsSystem2D.h"
 #include "Engine/src/core/audioSystem/AudioSystem.h"
+#include "Engine/src/core/utils/WorkerPool.h"
 
 
 namespace ChaosEngine {
@@ -24,7 +25,7 @@ namespace ChaosEngine {
         /// Create an application window and initialize the engine context
         Engine();
 
-        ~Engine() = default;
+        ~Engine();
 
         /**
          * Load scene configuration and apply the configuration to engine systems.
@@ -35,8 +36,8 @@ namespace ChaosEngine {
 
         /**
          * Run main-loop: <br/>
-         *  Update the engine systems.
-         *  TOBE: Parallelization > Apply component changes -> run systems
+         *  Apply recorded structural changes -> update the engine systems -> apply the changes of scripts and
+         *  collision callbacks -> update the scene
          */
         void run();
 
@@ -45,6 +46,15 @@ namespace ChaosEngine {
 
         std::shared_ptr<AssetManager> getAssetManager() { return assetManager; }
 
+        AudioSystem &getAudioSystem() { return audioSystem; }
+
+        WorkerPool &getWorkerPool() { return workerPool; }
+
+        /// Command buffer of the loaded scene
+        EntityCommandBuffer &getCommandBuffer();
+
+        ScriptScheduler &getScriptScheduler() { return nativeScriptSystem.getScheduler(); }
+
         // ------------------------------------ Runtime adjustable functions -------------------------------------------
 
         [[nodiscard]] bool getPhysicsDebug() const { return physicsDebug; }
@@ -56,8 +66,12 @@ namespace ChaosEngine {
 
     private:
         static Engine *s_engineInstance;
+        /// Mounted at startup if present, packed assets take precedence over loose files
+        static constexpr const char *assetPackFile = "assets.pack";
 
     private:
+        // Outlives all systems which hand work to it
+        WorkerPool workerPool;
         Window window;
 
         // Systems
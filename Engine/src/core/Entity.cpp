@@ -1 +1,35 @@
 #include "Entity.h"
+
+#include <stdexcept>
+
+#include "Components.h"
+
+using namespace ChaosEngine;
+
+void Entity::setParent(Entity parent) {
+    assert("Registry must not be null" && registry != nullptr);
+    assert("Parent must belong to the same registry" && registry == parent.registry);
+    if (!registry->valid(parent.entity))
+        throw std::runtime_error("Tried to set an invalid entity as parent");
+    for (auto ancestor = parent.entity; ancestor != entt::null;) {
+        if (ancestor == entity)
+            throw std::runtime_error("Tried to attach an entity to itself or one of its descendants");
+        const auto *ancestorParent = registry->try_get<ParentComponent>(ancestor);
+        ancestor = (ancestorParent != nullptr && registry->valid(ancestorParent->parent)) ? ancestorParent->parent
+                                                                                          : entt::null;
+    }
+    // Removed and added again instead of replaced, so the ECS moves the entity to the child list of the new parent
+    registry->remove<ParentComponent>(entity);
+    registry->emplace<ParentComponent>(entity, parent.entity);
+}
+
+void Entity::removeParent() {
+    assert("Registry must not be null" && registry != nullptr);
+    registry->remove<ParentComponent>(entity);
+}
+
+Entity Entity::getParent() const {
+    assert("Registry must not be null" && registry != nullptr);
+    const auto *parent = registry->try_get<ParentComponent>(entity);
+    return (parent != nullptr) ? Entity{registry, parent->parent} : Entity{};
+}
@@ -2,6 +2,10 @@
 
 #include <entt/entity/registry.hpp>
 
+#include <cassert>
+#include <tuple>
+#include <type_traits>
+
 namespace ChaosEngine {
     /**
      * This is a handler to an entity for modifying associated data.
@@ -10,6 +14,7 @@ namespace ChaosEngine {
      */
     class Entity {
         friend class ECS;
+        friend class EntityCommandBuffer;
 
     private:
         Entity(entt::registry* registry, entt::entity entity)
@@ -34,6 +39,31 @@ namespace ChaosEngine {
             registry->emplace_or_replace<Component>(entity, std::forward<Args>(args)...);
         }
 
+        /**
+         * Modifies the existing component of type <i>Component</i> in place and notifies change trackers.
+         * Mutations of tracked components (e.g. Transform) MUST go through patch or replace, see ChangeTracker.
+         * @tparam Component
+         * @tparam Func
+         * @param func to be called with a reference to the component
+         */
+        template <typename Component, typename... Func>
+        inline decltype(auto) patch(Func&&... func) {
+            assert("Registry must not be null" && registry != nullptr);
+            return registry->patch<Component>(entity, std::forward<Func>(func)...);
+        }
+
+        /**
+         * Replaces the existing component of type <i>Component</i> and notifies change trackers.
+         * @tparam Component
+         * @tparam Args
+         * @param args to be passed to the constructor of Component
+         */
+        template <typename Component, typename... Args>
+        inline decltype(auto) replace(Args&&... args) {
+            assert("Registry must not be null" && registry != nullptr);
+            return registry->replace<Component>(entity, std::forward<Args>(args)...);
+        }
+
         /**
          * Get the component of type <i>Component</i> of this entity.
          * @tparam Component
@@ -51,6 +81,23 @@ namespace ChaosEngine {
             return registry->get<Component...>(entity);
         }
 
+        /**
+         * Like get, but only reads the registry, so several threads may call it at once. The non-const lookup of get
+         * creates the storage of a component type on first use. The components MUST exist.
+         */
+        template <typename... Component>
+        [[nodiscard]] decltype(auto) getConcurrent() const {
+            assert("Registry must not be null" && registry != nullptr);
+            const entt::registry &readOnly = *registry;
+            // The components themselves are not const, only the registry is
+            if constexpr (sizeof...(Component) == 1) {
+                return (const_cast<Component &>(readOnly.get<std::remove_const_t<Component>>(entity)), ...);
+            } else {
+                return std::forward_as_tuple(
+                        const_cast<Component &>(readOnly.get<std::remove_const_t<Component>>(entity))...);
+            }
+        }
+
         /**
          * Check if the entity has a component of type <i>Component</i>.
          * @tparam Component
@@ -62,6 +109,20 @@ namespace ChaosEngine {
             return registry->all_of<Component...>(entity);
         }
 
+        /**
+         * Attaches this entity to the parent, its Transform is relative to the parent from then on.
+         * Throws if the parent is invalid or a descendant of this entity.
+         */
+        void setParent(Entity parent);
+
+        /// Detaches this entity from its parent, its Transform is relative to the scene again
+        void removeParent();
+
+        /// Returns a null entity handle if this entity has no parent
+        [[nodiscard]] Entity getParent() const;
+
+        [[nodiscard]] bool isNull() const { return registry == nullptr || entity == entt::null; }
+
         explicit operator uint32_t() const {
             static_assert(std::is_same<entt::id_type, std::uint32_t>::value,
                           "Entity is not of type uint32_t so it can't be casted to it");
@@ -0,0 +1,72 @@
+#include "EntityCommandBuffer.h"
+
+#include <cassert>
+
+#include "Ecs.h"
+
+using namespace ChaosEngine;
+
+EntityCommandBuffer::DeferredEntity EntityCommandBuffer::createEntity() {
+    std::lock_guard lock(mutex);
+    const DeferredEntity entity{deferredCount++, generation};
+    commands.push_back(Command{CommandType::Create, Target{entt::null, entity.index, entity.generation}, nullptr});
+    return entity;
+}
+
+void EntityCommandBuffer::destroyEntity(entt::entity entity) {
+    std::lock_guard lock(mutex);
+    commands.push_back(Command{CommandType::Destroy, Target{entity}, nullptr});
+}
+
+void EntityCommandBuffer::record(Target target, std::unique_ptr<ComponentCommand> &&component) {
+    std::lock_guard lock(mutex);
+    // The index alone could belong to an entity deferred since then
+    assert("Deferred entity was created before the last apply" &&
+           (target.deferred == notDeferred || (target.generation == generation && target.deferred < deferredCount)));
+    commands.push_back(Command{CommandType::Component, target, std::move(component)});
+}
+
+void EntityCommandBuffer::apply(ECS &ecs) {
+    std::vector<Command> pending;
+    uint32_t pendingDeferredCount;
+    {
+        std::lock_guard lock(mutex);
+        pending.swap(commands);
+        pendingDeferredCount = deferredCount;
+        deferredCount = 0;
+        ++generation;
+    }
+    if (pending.empty())
+        return;
+
+    auto &registry = ecs.getRegistry();
+    // Filled by the create commands, which are always recorded before the commands using their entity
+    std::vector<entt::entity> created(pendingDeferredCount);
+    std::vector<entt::entity> destroyed;
+    const auto resolve = [&created](const Target &target) {
+        return (target.deferred == notDeferred) ? target.entity : created[target.deferred];
+    };
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        auto &command = pending[i];
+        switch (command.type) {
+            case CommandType::Create:
+                created[command.target.deferred] = registry.create();
+                break;
+            case CommandType::Destroy:
+                // Consecutive destroys share one search for descendants
+                destroyed.push_back(resolve(command.target));
+                if (i + 1 == pending.size() || pending[i + 1].type != CommandType::Destroy) {
+                    ecs.removeEntities(destroyed);
+                    destroyed.clear();
+                }
+                break;
+            case CommandType::Component: {
+                const auto entity = resolve(command.target);
+                if (registry.valid(entity))
+                    command.component->apply(registry, entity);
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+#include <entt/entity/registry.hpp>
+
+#include "Entity.h"
+
+namespace ChaosEngine {
+    class ECS;
+
+    /**
+     * Records structural changes (creating and destroying entities, adding and removing components) which are applied
+     * in bulk at the sync points of the engine.
+     * Structural changes invalidate running views and must not happen while the physics world is stepping, so systems
+     * and scripts record them here instead. Recording is thread safe, the commands of one thread are applied in the
+     * order they were recorded.
+     */
+    class EntityCommandBuffer {
+    public:
+        /// Entity which is only created once the buffer is applied, valid for commands recorded before that
+        struct DeferredEntity {
+            uint32_t index;
+            uint32_t generation; // Apply which creates the entity, indices restart after every apply
+        };
+
+    public:
+        EntityCommandBuffer() = default;
+
+        ~EntityCommandBuffer() = default;
+
+        EntityCommandBuffer(const EntityCommandBuffer &o) = delete;
+
+        EntityCommandBuffer &operator=(const EntityCommandBuffer &o) = delete;
+
+        DeferredEntity createEntity();
+
+        /// Destroys the entity and all of its descendants, entities destroyed in the meantime are skipped
+        void destroyEntity(entt::entity entity);
+
+        void destroyEntity(Entity entity) { destroyEntity(entity.entity); }
+
+        /// Adds or overwrites the component, the component is constructed right away and moved in once applied
+        template<typename Component, typename... Args>
+        void setComponent(entt::entity entity, Args &&... args) {
+            record(Target{entity}, std::make_unique<SetComponent<Component>>(std::forward<Args>(args)...));
+        }
+
+        template<typename Component, typename... Args>
+        void setComponent(Entity entity, Args &&... args) {
+            setComponent<Component>(entity.entity, std::forward<Args>(args)...);
+        }
+
+        template<typename Component, typename... Args>
+        void setComponent(DeferredEntity entity, Args &&... args) {
+            record(Target{entt::null, entity.index, entity.generation},
+                   std::make_unique<SetComponent<Component>>(std::forward<Args>(args)...));
+        }
+
+        template<typename Component>
+        void removeComponent(entt::entity entity) {
+            record(Target{entity}, std::make_unique<RemoveComponent<Component>>());
+        }
+
+        template<typename Component>
+        void removeComponent(Entity entity) { removeComponent<Component>(entity.entity); }
+
+        /**
+         * Applies and clears all recorded commands.
+         * Commands recorded while applying (e.g. by destructors of components) are kept for the next apply.
+         * @note MUST NOT be called while systems iterate over the registry
+         */
+        void apply(ECS &ecs);
+
+        [[nodiscard]] bool empty() const {
+            std::lock_guard lock(mutex);
+            return commands.empty();
+        }
+
+    private:
+        static constexpr uint32_t notDeferred = std::numeric_limits<uint32_t>::max();
+
+        struct Target {
+            entt::entity entity;
+            uint32_t deferred = notDeferred;
+            uint32_t generation = 0; // Only used by deferred targets
+        };
+
+        struct ComponentCommand {
+            virtual ~ComponentCommand() = default;
+
+            virtual void apply(entt::registry &registry, entt::entity entity) = 0;
+        };
+
+        template<typename Component>
+        struct SetComponent final : ComponentCommand {
+            template<typename... Args>
+            explicit SetComponent(Args &&... args) : component(std::forward<Args>(args)...) {}
+
+            void apply(entt::registry &registry, entt::entity entity) override {
+                registry.emplace_or_replace<Component>(entity, std::move(component));
+            }
+
+            Component component;
+        };
+
+        template<typename Component>
+        struct RemoveComponent final : ComponentCommand {
+            void apply(entt::registry &registry, entt::entity entity) override {
+                registry.remove<Component>(entity);
+            }
+        };
+
+        enum class CommandType {
+            Create, Destroy, Component
+        };
+
+        struct Command {
+            CommandType type;
+            Target target;
+            std::unique_ptr<ComponentCommand> component;
+        };
+
+        void record(Target target, std::unique_ptr<ComponentCommand> &&component);
+
+    private:
+        mutable std::mutex mutex;
+        std::vector<Command> commands{};
+        uint32_t deferredCount = 0;
+        uint32_t generation = 0; // Incremented by every apply
+    };
+
+}
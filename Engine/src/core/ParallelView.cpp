@@ -0,0 +1,32 @@
+#include "ParallelView.h"
+
+#include <cassert>
+
+using namespace ChaosEngine;
+
+void ComponentAccess::acquire(std::type_index type, bool read) {
+    std::lock_guard lock(mutex);
+    auto &count = users[type];
+    if (read) {
+        assert("Component is read while another loop writes it" && count >= 0);
+        ++count;
+    } else {
+        assert("Component is written while another loop uses it" && count == 0);
+        count = -1;
+    }
+}
+
+void ComponentAccess::release(std::type_index type, bool read) {
+    std::lock_guard lock(mutex);
+    auto &count = users[type];
+    count = read ? count - 1 : 0;
+}
+
+void ComponentAccess::check(std::type_index type, bool read) {
+    std::lock_guard lock(mutex);
+    const auto user = users.find(type);
+    if (user == users.end())
+        return;
+    assert("Component is used while another loop writes it" && user->second >= 0);
+    assert("Component is written while another loop reads it" && (read || user->second == 0));
+}
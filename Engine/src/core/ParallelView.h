@@ -0,0 +1,160 @@
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <mutex>
+#include <algorithm>
+#include <typeindex>
+#include <type_traits>
+#include <unordered_map>
+#include <cstdint>
+
+#include <entt/entity/registry.hpp>
+
+#include "Engine/src/core/utils/WorkerPool.h"
+
+namespace ChaosEngine {
+
+    /**
+     * Tracks the components used by running parallel loops.
+     * Const components are read, all others are written. A component may be read by any number of loops or written by
+     * a single one at a time, conflicting access asserts. The checks only exist in debug builds.
+     */
+    class ComponentAccess {
+    public:
+        ComponentAccess() = default;
+
+        ~ComponentAccess() = default;
+
+        ComponentAccess(const ComponentAccess &o) = delete;
+
+        ComponentAccess &operator=(const ComponentAccess &o) = delete;
+
+        template<typename... Component>
+        void acquire() {
+#ifndef NDEBUG
+            (acquire(typeid(std::remove_const_t<Component>), std::is_const_v<Component>), ...);
+#endif
+        }
+
+        template<typename... Component>
+        void release() {
+#ifndef NDEBUG
+            (release(typeid(std::remove_const_t<Component>), std::is_const_v<Component>), ...);
+#endif
+        }
+
+        /// Asserts if the component is currently used by a loop which does not allow the access
+        template<typename Component>
+        void check() {
+#ifndef NDEBUG
+            check(typeid(std::remove_const_t<Component>), std::is_const_v<Component>);
+#endif
+        }
+
+    private:
+        void acquire(std::type_index type, bool read);
+
+        void release(std::type_index type, bool read);
+
+        void check(std::type_index type, bool read);
+
+    private:
+        std::mutex mutex;
+        // Number of readers, or -1 while written
+        std::unordered_map<std::type_index, int32_t> users{};
+    };
+
+    /**
+     * Snapshot of all entities with the components, processed in chunks on the workers and the calling thread.
+     * Const components are only readable. The components stay acquired in the ComponentAccess for the lifetime of the
+     * view, structural changes MUST be recorded in the EntityCommandBuffer meanwhile.
+     * Chunks hold at least minChunkSize entities, so neighbouring chunks only rarely write to the same cache line. Large
+     * views are split into several chunks per thread to balance uneven work.
+     * Views over an owning group keep pointers to the components in the packed order of the group instead of looking
+     * them up per entity, so all components are read front to back.
+     */
+    template<typename... Component>
+    class ParallelView {
+        static_assert(sizeof...(Component) > 0, "A parallel view needs at least one component");
+
+    public:
+        /// Views with fewer entities are processed on the calling thread
+        static constexpr size_t minChunkSize = 256;
+        static constexpr size_t chunksPerThread = 4;
+
+        /// Selects the owning group of the components as the source of the view
+        struct OwningGroup {
+        };
+
+    public:
+        ParallelView(entt::registry &registry, WorkerPool &workers, ComponentAccess &access)
+                : view(registry.view<Component...>()), workers(workers), access(access) {
+            access.acquire<Component...>();
+            entities.assign(view.begin(), view.end());
+        }
+
+        /// The group is created on first use, the components MUST NOT be owned by another group
+        ParallelView(entt::registry &registry, WorkerPool &workers, ComponentAccess &access, OwningGroup)
+                : view(registry.view<Component...>()), workers(workers), access(access) {
+            access.acquire<Component...>();
+            auto group = registry.group<std::remove_const_t<Component>...>();
+            entities.reserve(group.size());
+            packed.reserve(group.size());
+            // Iterating the group walks the packed pools directly
+            group.each([this](entt::entity entity, std::remove_const_t<Component> &... components) {
+                entities.push_back(entity);
+                packed.emplace_back(&components...);
+            });
+        }
+
+        ~ParallelView() { access.release<Component...>(); }
+
+        ParallelView(const ParallelView &o) = delete;
+
+        ParallelView &operator=(const ParallelView &o) = delete;
+
+        [[nodiscard]] size_t size() const { return entities.size(); }
+
+        [[nodiscard]] bool empty() const { return entities.empty(); }
+
+        [[nodiscard]] entt::entity entity(size_t index) const { return entities[index]; }
+
+        /// Components of the entity at the index
+        [[nodiscard]] std::tuple<Component &...> get(size_t index) const {
+            if (!packed.empty())
+                return std::apply([](Component *... components) { return std::tie(*components...); }, packed[index]);
+            return std::forward_as_tuple(view.template get<Component>(entities[index])...);
+        }
+
+        /// Calls function(begin, end) for chunks of entity indices, e.g. to gather results per chunk
+        template<typename Function>
+        void chunks(Function &&function) {
+            workers.parallelFor(entities.size(), chunkSize(), function);
+        }
+
+        /// Calls function(entity, components...) for every entity
+        template<typename Function>
+        void each(Function &&function) {
+            chunks([this, &function](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    std::apply([&](auto &... components) { function(entities[i], components...); }, get(i));
+                }
+            });
+        }
+
+    private:
+        [[nodiscard]] size_t chunkSize() const {
+            const size_t threads = workers.getWorkerCount() + 1;
+            return std::max(minChunkSize, entities.size() / (threads * chunksPerThread));
+        }
+
+    private:
+        decltype(std::declval<entt::registry &>().view<Component...>()) view;
+        WorkerPool &workers;
+        ComponentAccess &access;
+        std::vector<entt::entity> entities{};
+        std::vector<std::tuple<Component *...>> packed{}; // Only filled for owning groups
+    };
+
+}
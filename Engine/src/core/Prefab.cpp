@@ -0,0 +1,27 @@
+#include "Prefab.h"
+
+using namespace ChaosEngine;
+
+std::vector<ECS::entity_t> Prefab::instantiate(ECS &ecs, size_t count) const {
+    auto entities = ecs.addEntities(count);
+    // Value components first, so factories can already read them from their instance
+    instantiateComponents(ecs, entities, false);
+    instantiateComponents(ecs, entities, true);
+    return entities;
+}
+
+void Prefab::instantiateComponents(ECS &ecs, const std::vector<ECS::entity_t> &entities, bool perInstance) const {
+    for (const auto &component: components) {
+        if (component->perInstance == perInstance)
+            component->instantiate(ecs, entities);
+    }
+}
+
+void Prefab::store(std::unique_ptr<ComponentTemplate> &&component) {
+    auto existing = std::find_if(components.begin(), components.end(),
+                                 [&component](const auto &other) { return other->type == component->type; });
+    if (existing != components.end())
+        *existing = std::move(component);
+    else
+        components.push_back(std::move(component));
+}
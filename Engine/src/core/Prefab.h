@@ -0,0 +1,126 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <typeindex>
+#include <algorithm>
+#include <functional>
+#include <cassert>
+
+#include <entt/entity/registry.hpp>
+
+#include "Ecs.h"
+
+namespace ChaosEngine {
+
+    /**
+     * Template of component values which is instantiated many times at once.
+     * Copyable components are added to all instances with a single range insert per component, components which can
+     * not be shared (e.g. scripts or rigid bodies) are created per instance by a factory.
+     */
+    class Prefab {
+    public:
+        Prefab() = default;
+
+        ~Prefab() = default;
+
+        Prefab(const Prefab &o) = delete;
+
+        Prefab &operator=(const Prefab &o) = delete;
+
+        Prefab(Prefab &&o) noexcept = default;
+
+        Prefab &operator=(Prefab &&o) noexcept = default;
+
+        /// Adds or overwrites the component, every instance gets a copy of the value
+        template<typename Component>
+        Prefab &set(Component value) {
+            store(std::make_unique<ValueTemplate<Component>>(std::move(value)));
+            return *this;
+        }
+
+        /// Adds or overwrites the component, the factory creates the component of every instance
+        template<typename Component>
+        Prefab &setFactory(std::function<Component(Entity)> factory) {
+            store(std::make_unique<FactoryTemplate<Component>>(std::move(factory)));
+            return *this;
+        }
+
+        /// Removes the component from the prefab, existing instances are not changed
+        template<typename Component>
+        Prefab &remove() {
+            std::erase_if(components, [](const auto &component) { return component->type == typeid(Component); });
+            return *this;
+        }
+
+        template<typename Component>
+        [[nodiscard]] bool has() const {
+            return std::any_of(components.begin(), components.end(),
+                               [](const auto &component) { return component->type == typeid(Component); });
+        }
+
+        /// Creates count instances of the prefab
+        std::vector<ECS::entity_t> instantiate(ECS &ecs, size_t count) const;
+
+        /**
+         * Creates one instance per value, which gets the value in addition to the prefab components, e.g. the
+         * Transforms of the tiles of a level. The value is added before the factories run, so they can read it.
+         */
+        template<typename Component>
+        std::vector<ECS::entity_t> instantiate(ECS &ecs, const std::vector<Component> &values) const {
+            assert("The per instance component must not be part of the prefab" && !has<Component>());
+            auto entities = ecs.addEntities(values.size());
+            instantiateComponents(ecs, entities, false);
+            ecs.getRegistry().insert<Component>(entities.begin(), entities.end(), values.begin());
+            instantiateComponents(ecs, entities, true);
+            return entities;
+        }
+
+    private:
+        struct ComponentTemplate {
+            ComponentTemplate(std::type_index type, bool perInstance) : type(type), perInstance(perInstance) {}
+
+            virtual ~ComponentTemplate() = default;
+
+            virtual void instantiate(ECS &ecs, const std::vector<ECS::entity_t> &entities) const = 0;
+
+            std::type_index type;
+            bool perInstance;
+        };
+
+        template<typename Component>
+        struct ValueTemplate final : ComponentTemplate {
+            explicit ValueTemplate(Component &&value) : ComponentTemplate(typeid(Component), false), value(std::move(value)) {}
+
+            void instantiate(ECS &ecs, const std::vector<ECS::entity_t> &entities) const override {
+                ecs.getRegistry().insert<Component>(entities.begin(), entities.end(), value);
+            }
+
+            Component value;
+        };
+
+        template<typename Component>
+        struct FactoryTemplate final : ComponentTemplate {
+            explicit FactoryTemplate(std::function<Component(Entity)> &&factory)
+                    : ComponentTemplate(typeid(Component), true), factory(std::move(factory)) {}
+
+            void instantiate(ECS &ecs, const std::vector<ECS::entity_t> &entities) const override {
+                auto &registry = ecs.getRegistry();
+                for (auto entity: entities) {
+                    registry.emplace<Component>(entity, factory(ecs.getEntity(entity)));
+                }
+            }
+
+            std::function<Component(Entity)> factory;
+        };
+
+        void store(std::unique_ptr<ComponentTemplate> &&component);
+
+        /// Adds either the value or the factory components to the entities
+        void instantiateComponents(ECS &ecs, const std::vector<ECS::entity_t> &entities, bool perInstance) const;
+
+    private:
+        std::vector<std::unique_ptr<ComponentTemplate>> components{};
+    };
+
+}
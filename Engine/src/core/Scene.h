@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Ecs.h"
+#include "Prefab.h"
+#include "scriptSystem/BatchScript.h"
 #include "physicsSystem/PhysicsWorld.h"
 #include "Engine/src/renderer/api/RendererAPI.h"
 #include "Engine/src/renderer/window/Window.h"
@@ -8,11 +10,18 @@
 namespace ChaosEngine {
     class Engine;
 
+    /// Output of the AudioSystem, selected by the scene configuration
+    enum class AudioBackend {
+        Device, // Default output device of the system
+        Loopback, // Mixed into memory in lockstep with the engine clock, works without a sound card
+    };
+
     /// Via this struct the scene is able to configure the engine runtime.
     struct SceneConfiguration {
         Renderer::RendererType rendererType; // TOBE: Abstraction layer
         bool renderSceneToOffscreenBuffer;
         bool debugRenderingEnabled = false;
+        AudioBackend audioBackend = AudioBackend::Device;
     };
 
     /**
@@ -20,6 +29,7 @@ namespace ChaosEngine {
      */
     class Scene {
         friend class Engine;
+        friend class NativeScriptSystem;
 
     public:
         Scene() : physicsWorld(glm::vec2(0, 0)), ecs() {}
@@ -46,14 +56,41 @@ namespace ChaosEngine {
 
         Entity createEntity() { return ecs.addEntity(); }
 
+        /// Creates count entities at once, each with a copy of the components
+        template<typename... Component>
+        std::vector<ECS::entity_t> createEntities(size_t count, const Component &... components) {
+            return ecs.addEntities(count, components...);
+        }
+
+        /// Creates count instances of the prefab
+        std::vector<ECS::entity_t> instantiate(const Prefab &prefab, size_t count) {
+            return prefab.instantiate(ecs, count);
+        }
+
+        /// Creates one instance of the prefab per value, e.g. the tiles of a level from their Transforms
+        template<typename Component>
+        std::vector<ECS::entity_t> instantiate(const Prefab &prefab, const std::vector<Component> &values) {
+            return prefab.instantiate(ecs, values);
+        }
+
+        /// Adds a script which processes all entities with its components at once, see BatchScript
+        template<typename Script, typename... Args>
+        Script &addBatchScript(Args &&... args) {
+            auto script = std::make_unique<Script>(std::forward<Args>(args)...);
+            Script &ref = *script;
+            batchScripts.push_back(std::move(script));
+            return ref;
+        }
+
         ECS &getECS() { return ecs; }
 
         PhysicsWorld &getPhysicsWorld() { return physicsWorld; }
 
     protected:
         PhysicsWorld physicsWorld;
-        ECS ecs;
-        //TOBE: Scene tree
+        ECS ecs; // Entities form a tree through ParentComponents, see Entity::setParent
+        // Updated in the order they were added
+        std::vector<std::unique_ptr<BatchScriptBase>> batchScripts{};
     };
 
 }
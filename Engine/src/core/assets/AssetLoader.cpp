@@ -1,14 +1,60 @@
 #include "AssetLoader.h"
+#include "AssetPack.h"
+
+#include "Engine/src/core/utils/Logger.h"
 
 #include <fstream>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
 
 namespace fs = std::filesystem;
 
 namespace ChaosEngine::AssetLoader {
 
+    // Loaders are called from the asset decode workers, so the mounted packs need to be guarded
+    static std::shared_mutex packMutex;
+    static std::vector<std::unique_ptr<AssetPack>> mountedPacks;
+
+    void mountPack(const std::string &packFile) {
+        auto pack = std::make_unique<AssetPack>(AssetPack::Open(packFile));
+        LOG_INFO("[AssetLoader] Mounted asset pack '{}' with {} entries", packFile, pack->getEntryCount());
+        std::unique_lock lock(packMutex);
+        mountedPacks.emplace_back(std::move(pack));
+    }
+
+    void unmountAll() {
+        std::unique_lock lock(packMutex);
+        mountedPacks.clear();
+    }
+
+    static std::optional<std::vector<char>> readFromPacks(const std::string &filePath) {
+        std::shared_lock lock(packMutex);
+        for (auto it = mountedPacks.rbegin(); it != mountedPacks.rend(); ++it) {
+            if (auto data = (*it)->read(filePath))
+                return data;
+        }
+        return std::nullopt;
+    }
+
+    bool exists(const std::string &filePath) {
+        {
+            std::shared_lock lock(packMutex);
+            for (const auto &pack: mountedPacks) {
+                if (pack->contains(filePath))
+                    return true;
+            }
+        }
+        return fs::exists(fs::path(filePath));
+    }
+
     std::string loadString(const std::string &filePath) {
-        if (!exists(fs::path(filePath)))
+        if (auto data = readFromPacks(filePath))
+            return std::string(data->begin(), data->end());
+
+        if (!fs::exists(fs::path(filePath)))
             throw std::runtime_error("Requested file does not exist: '" + filePath + "'");
 
         std::ifstream input(filePath);
@@ -22,7 +68,10 @@ namespace ChaosEngine::AssetLoader {
     }
 
     std::vector<char> loadBinary(const std::string &filePath) {
-        if (!exists(fs::path(filePath)))
+        if (auto data = readFromPacks(filePath))
+            return std::move(*data);
+
+        if (!fs::exists(fs::path(filePath)))
             throw std::runtime_error("Requested file does not exist: '" + filePath + "'");
 
         std::ifstream input(filePath, std::ios::binary);
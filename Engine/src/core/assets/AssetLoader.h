@@ -4,10 +4,18 @@
 #include <vector>
 
 namespace ChaosEngine::AssetLoader {
-    std::string loadString(const std::string &filePath);
+    /**
+     * Mounts an asset pack, afterwards files contained in it are loaded from the pack instead of the file system.
+     * Packs mounted later take precedence over earlier ones.
+     */
+    void mountPack(const std::string &packFile);
 
-    std::vector<char> loadBinary(const std::string &filePath);
-}
+    void unmountAll();
 
+    /// Checks the mounted packs and the file system
+    bool exists(const std::string &filePath);
 
+    std::string loadString(const std::string &filePath);
 
+    std::vector<char> loadBinary(const std::string &filePath);
+}
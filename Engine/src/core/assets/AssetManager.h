@@ -12,6 +12,7 @@
 #include "Engine/src/core/Components.h"
 
 #include "FontManager.h"
+#include "TextureStreamer.h"
 
 namespace ChaosEngine {
 
@@ -72,9 +73,12 @@ namespace ChaosEngine {
         getAllMaterials() const { return materials; }
 
         // ------------------------------------ Textures ---------------------------------------------------------------
+        /// Textures loaded from a file are streamed, i.e. evicted to a low resolution when the budget is exceeded
         Renderer::Texture *
         registerTexture(const std::string &uri, std::unique_ptr<Renderer::Texture> &&texture, TextureInfo texInfo) {
             auto tex = textures.emplace(uri, std::make_pair(std::move(texture), texInfo));
+            if (tex.second)
+                textureStreamer.track(tex.first->second.first.get());
             return tex.first->second.first.get();
         }
 
@@ -85,6 +89,8 @@ namespace ChaosEngine {
         [[nodiscard]] const std::unordered_map<std::string, std::pair<std::unique_ptr<Renderer::Texture>, TextureInfo>> &
         getAllTextures() const { return textures; }
 
+        [[nodiscard]] TextureStreamer &getTextureStreamer() { return textureStreamer; }
+
         // ------------------------------------ Native Scripts ---------------------------------------------------------
         void
         registerNativeScript(const std::string &uri, const NativeScriptCreator &nativeScriptCreator,
@@ -134,6 +140,7 @@ namespace ChaosEngine {
         std::unordered_map<std::string, std::pair<std::shared_ptr<Renderer::RenderMesh>, MeshInfo>> meshes{};
         std::unordered_map<std::string, std::pair<Renderer::MaterialRef, MaterialInfo>> materials{};
         std::unordered_map<std::string, std::pair<std::unique_ptr<Renderer::Texture>, TextureInfo>> textures{};
+        TextureStreamer textureStreamer; // Tracks the textures above
         std::unordered_map<std::string, std::pair<NativeScriptCreator, ScriptInfo>> scripts{};
         std::unordered_map<std::string, std::pair<std::shared_ptr<AudioBuffer>, AudioBufferInfo>> audioBuffers{};
         FontManager fontManager;
@@ -0,0 +1,294 @@
+#include "AssetPack.h"
+#include "LZCodec.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+namespace ChaosEngine {
+
+    static_assert(sizeof(AssetPack::Header) == 16, "Asset pack header layout changed!");
+    static_assert(sizeof(AssetPack::Entry) == 40, "Asset pack entry layout changed!");
+
+// ------------------------------------ Mapped File --------------------------------------------------------------------
+
+    MappedFile::MappedFile(const char *data, size_t size, void *platformHandle)
+            : mapping(data), mappingSize(size), platformHandle(platformHandle) {}
+
+    MappedFile::~MappedFile() { close(); }
+
+    MappedFile::MappedFile(MappedFile &&o) noexcept
+            : mapping(std::exchange(o.mapping, nullptr)), mappingSize(std::exchange(o.mappingSize, 0)),
+              platformHandle(std::exchange(o.platformHandle, nullptr)) {}
+
+    MappedFile &MappedFile::operator=(MappedFile &&o) noexcept {
+        if (&o == this)
+            return *this;
+        close();
+        mapping = std::exchange(o.mapping, nullptr);
+        mappingSize = std::exchange(o.mappingSize, 0);
+        platformHandle = std::exchange(o.platformHandle, nullptr);
+        return *this;
+    }
+
+#ifdef _WIN32
+
+    MappedFile MappedFile::Open(const std::string &filename) {
+        HANDLE fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Failed to open file for mapping: '" + filename + "'");
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(fileHandle, &fileSize);
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(fileHandle); // The mapping keeps the file open
+        if (mappingHandle == nullptr)
+            throw std::runtime_error("Failed to map file: '" + filename + "'");
+        const void *data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr) {
+            CloseHandle(mappingHandle);
+            throw std::runtime_error("Failed to map file: '" + filename + "'");
+        }
+        return MappedFile{static_cast<const char *>(data), static_cast<size_t>(fileSize.QuadPart), mappingHandle};
+    }
+
+    void MappedFile::close() {
+        if (mapping != nullptr) {
+            UnmapViewOfFile(mapping);
+            CloseHandle(platformHandle);
+            mapping = nullptr;
+        }
+    }
+
+#else
+
+    MappedFile MappedFile::Open(const std::string &filename) {
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("Failed to open file for mapping: '" + filename + "'");
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to map empty or unreadable file: '" + filename + "'");
+        }
+        const auto size = static_cast<size_t>(fileStat.st_size);
+        void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping keeps the file open
+        if (data == MAP_FAILED)
+            throw std::runtime_error("Failed to map file: '" + filename + "'");
+        // Entries are accessed in no particular order
+        madvise(data, size, MADV_RANDOM);
+        return MappedFile{static_cast<const char *>(data), size, nullptr};
+    }
+
+    void MappedFile::close() {
+        if (mapping != nullptr) {
+            munmap(const_cast<char *>(mapping), mappingSize);
+            mapping = nullptr;
+        }
+    }
+
+#endif
+
+// ------------------------------------ Asset Pack ---------------------------------------------------------------------
+
+    AssetPack::AssetPack(MappedFile &&pFile) : file(std::move(pFile)), entryCount(0), pathTableOffset(0) {
+        if (file.size() < sizeof(Header))
+            throw std::runtime_error("[AssetPack] File too small for an asset pack");
+        Header header{};
+        std::memcpy(&header, file.data(), sizeof(Header));
+        if (std::memcmp(header.magic, magic, sizeof(magic)) != 0)
+            throw std::runtime_error("[AssetPack] Invalid asset pack magic");
+        if (header.version != version)
+            throw std::runtime_error("[AssetPack] Unsupported asset pack version " + std::to_string(header.version));
+
+        entryCount = header.entryCount;
+        pathTableOffset = sizeof(Header) + static_cast<uint64_t>(entryCount) * sizeof(Entry);
+        if (pathTableOffset + header.pathTableSize > file.size())
+            throw std::runtime_error("[AssetPack] Truncated asset pack index");
+        for (uint32_t i = 0; i < entryCount; ++i) {
+            const auto entry = getEntry(i);
+            if (entry.offset + entry.storedSize > file.size() ||
+                entry.pathOffset + entry.pathLength > header.pathTableSize)
+                throw std::runtime_error("[AssetPack] Corrupt asset pack entry " + std::to_string(i));
+        }
+    }
+
+    AssetPack AssetPack::Open(const std::string &filename) {
+        return AssetPack{MappedFile::Open(filename)};
+    }
+
+    std::string AssetPack::normalizePath(const std::string &path) {
+        std::string normalized = path;
+        std::replace(normalized.begin(), normalized.end(), '\\', '/');
+        while (normalized.rfind("./", 0) == 0) {
+            normalized.erase(0, 2);
+        }
+        return normalized;
+    }
+
+    uint64_t AssetPack::hashPath(std::string_view normalizedPath) {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char c: normalizedPath) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    AssetPack::Entry AssetPack::getEntry(uint32_t index) const {
+        Entry entry{};
+        std::memcpy(&entry, file.data() + sizeof(Header) + static_cast<uint64_t>(index) * sizeof(Entry), sizeof(Entry));
+        return entry;
+    }
+
+    std::optional<AssetPack::Entry> AssetPack::find(const std::string &path) const {
+        const auto normalized = normalizePath(path);
+        const uint64_t hash = hashPath(normalized);
+
+        // Lower bound on the sorted hashes, then compare the paths of all entries sharing the hash
+        uint32_t low = 0;
+        uint32_t high = entryCount;
+        while (low < high) {
+            const uint32_t mid = low + (high - low) / 2;
+            if (getEntry(mid).pathHash < hash)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        for (uint32_t i = low; i < entryCount; ++i) {
+            const auto entry = getEntry(i);
+            if (entry.pathHash != hash)
+                break;
+            const std::string_view entryPath(file.data() + pathTableOffset + entry.pathOffset, entry.pathLength);
+            if (entryPath == normalized)
+                return entry;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::vector<char>> AssetPack::read(const std::string &path) const {
+        const auto entry = find(path);
+        if (!entry)
+            return std::nullopt;
+
+        const char *stored = file.data() + entry->offset;
+        switch (entry->compression) {
+            case Compression::None:
+                return std::vector<char>(stored, stored + entry->storedSize);
+            case Compression::LZ: {
+                std::vector<char> data(entry->size);
+                if (!LZCodec::decompress(stored, entry->storedSize, data.data(), data.size()))
+                    throw std::runtime_error("[AssetPack] Corrupt compressed entry '" + path + "'");
+                return data;
+            }
+            default:
+                throw std::runtime_error("[AssetPack] Unknown compression of entry '" + path + "'");
+        }
+    }
+
+    std::optional<std::string_view> AssetPack::view(const std::string &path) const {
+        const auto entry = find(path);
+        if (!entry || entry->compression != Compression::None)
+            return std::nullopt;
+        return std::string_view(file.data() + entry->offset, entry->storedSize);
+    }
+
+// ------------------------------------ Asset Pack Writer --------------------------------------------------------------
+
+    void AssetPackWriter::add(const std::string &path, const std::vector<char> &data, bool compress) {
+        PendingEntry entry{AssetPack::normalizePath(path), {}, data.size(), AssetPack::Compression::None};
+        if (entry.path.size() > std::numeric_limits<uint16_t>::max())
+            throw std::runtime_error("[AssetPack] Path of " + std::to_string(entry.path.size()) +
+                                     " bytes is too long for an asset pack entry");
+        if (compress && !data.empty()) {
+            auto compressed = LZCodec::compress(data.data(), data.size());
+            if (compressed.size() < data.size()) {
+                entry.storedData = std::move(compressed);
+                entry.compression = AssetPack::Compression::LZ;
+            }
+        }
+        if (entry.compression == AssetPack::Compression::None)
+            entry.storedData = data;
+
+        // Adding the same path again replaces the previous entry
+        auto existing = std::find_if(entries.begin(), entries.end(),
+                                     [&](const PendingEntry &e) { return e.path == entry.path; });
+        if (existing != entries.end())
+            *existing = std::move(entry);
+        else
+            entries.emplace_back(std::move(entry));
+    }
+
+    void AssetPackWriter::write(const std::string &filename) const {
+        std::vector<const PendingEntry *> sorted;
+        sorted.reserve(entries.size());
+        for (const auto &entry: entries) {
+            sorted.emplace_back(&entry);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const PendingEntry *a, const PendingEntry *b) {
+            return AssetPack::hashPath(a->path) < AssetPack::hashPath(b->path);
+        });
+
+        std::string pathTable;
+        for (const auto *entry: sorted) {
+            pathTable += entry->path;
+        }
+        if (pathTable.size() > std::numeric_limits<uint32_t>::max())
+            throw std::runtime_error("[AssetPack] Path table too large for an asset pack");
+
+        AssetPack::Header header{};
+        std::memcpy(header.magic, AssetPack::magic, sizeof(header.magic));
+        header.version = AssetPack::version;
+        header.entryCount = static_cast<uint32_t>(sorted.size());
+        header.pathTableSize = static_cast<uint32_t>(pathTable.size());
+
+        std::vector<AssetPack::Entry> index;
+        index.reserve(sorted.size());
+        uint64_t dataOffset = sizeof(AssetPack::Header) + sorted.size() * sizeof(AssetPack::Entry) + pathTable.size();
+        uint32_t pathOffset = 0;
+        for (const auto *entry: sorted) {
+            index.emplace_back(AssetPack::Entry{
+                    .pathHash = AssetPack::hashPath(entry->path),
+                    .offset = dataOffset,
+                    .storedSize = entry->storedData.size(),
+                    .size = entry->size,
+                    .pathOffset = pathOffset,
+                    .pathLength = static_cast<uint16_t>(entry->path.size()),
+                    .compression = entry->compression,
+                    .reserved = 0,
+            });
+            dataOffset += entry->storedData.size();
+            pathOffset += static_cast<uint32_t>(entry->path.size());
+        }
+
+        std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+        if (!output.is_open())
+            throw std::runtime_error("[AssetPack] Failed to open '" + filename + "' for writing");
+        output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char *>(index.data()),
+                     static_cast<std::streamsize>(index.size() * sizeof(AssetPack::Entry)));
+        output.write(pathTable.data(), static_cast<std::streamsize>(pathTable.size()));
+        for (const auto *entry: sorted) {
+            output.write(entry->storedData.data(), static_cast<std::streamsize>(entry->storedData.size()));
+        }
+        if (!output)
+            throw std::runtime_error("[AssetPack] Failed to write '" + filename + "'");
+    }
+
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <cstdint>
+
+namespace ChaosEngine {
+
+    /// Read only memory mapping of a complete file.
+    class MappedFile {
+    private:
+        MappedFile(const char *data, size_t size, void *platformHandle);
+
+    public:
+        ~MappedFile();
+
+        MappedFile(const MappedFile &o) = delete;
+
+        MappedFile &operator=(const MappedFile &o) = delete;
+
+        MappedFile(MappedFile &&o) noexcept;
+
+        MappedFile &operator=(MappedFile &&o) noexcept;
+
+        static MappedFile Open(const std::string &filename);
+
+        [[nodiscard]] const char *data() const { return mapping; }
+
+        [[nodiscard]] size_t size() const { return mappingSize; }
+
+    private:
+        void close();
+
+    private:
+        const char *mapping;
+        size_t mappingSize;
+        void *platformHandle; // File mapping handle on Windows, unused otherwise
+    };
+
+    /**
+     * Single file archive of assets, accessed through a memory mapping so opening an asset is a binary search.
+     *
+     * Layout: Header | Entries sorted by path hash | Path table | Entry data
+     * Paths are stored relative to the asset root with '/' separators, e.g. "textures/TestAtlas.jpg".
+     */
+    class AssetPack {
+    public:
+        enum class Compression : uint8_t {
+            None = 0, LZ = 1,
+        };
+
+        struct Header {
+            char magic[4];
+            uint32_t version;
+            uint32_t entryCount;
+            uint32_t pathTableSize;
+        };
+
+        struct Entry {
+            uint64_t pathHash;
+            uint64_t offset; // From the start of the file
+            uint64_t storedSize;
+            uint64_t size;
+            uint32_t pathOffset; // Into the path table
+            uint16_t pathLength;
+            Compression compression;
+            uint8_t reserved;
+        };
+
+        static constexpr char magic[4] = {'C', 'E', 'P', 'K'};
+        static constexpr uint32_t version = 1;
+
+    private:
+        explicit AssetPack(MappedFile &&file);
+
+    public:
+        ~AssetPack() = default;
+
+        AssetPack(const AssetPack &o) = delete;
+
+        AssetPack &operator=(const AssetPack &o) = delete;
+
+        AssetPack(AssetPack &&o) noexcept = default;
+
+        AssetPack &operator=(AssetPack &&o) noexcept = delete;
+
+        static AssetPack Open(const std::string &filename);
+
+        [[nodiscard]] bool contains(const std::string &path) const { return find(path).has_value(); }
+
+        /// Reads and if necessary decompresses an entry, std::nullopt if it is not part of this pack
+        [[nodiscard]] std::optional<std::vector<char>> read(const std::string &path) const;
+
+        /// Direct view into the mapping, only available for uncompressed entries
+        [[nodiscard]] std::optional<std::string_view> view(const std::string &path) const;
+
+        [[nodiscard]] uint32_t getEntryCount() const { return entryCount; }
+
+        static std::string normalizePath(const std::string &path);
+
+        /// FNV-1a over the normalized path
+        static uint64_t hashPath(std::string_view normalizedPath);
+
+    private:
+        [[nodiscard]] std::optional<Entry> find(const std::string &path) const;
+
+        [[nodiscard]] Entry getEntry(uint32_t index) const;
+
+    private:
+        MappedFile file;
+        uint32_t entryCount;
+        uint64_t pathTableOffset;
+    };
+
+    /// Builds asset packs, entries are only compressed if that actually saves space.
+    class AssetPackWriter {
+    public:
+        AssetPackWriter() = default;
+
+        ~AssetPackWriter() = default;
+
+        /// Throws if the normalized path does not fit into an entry (64 KiB)
+        void add(const std::string &path, const std::vector<char> &data, bool compress = true);
+
+        void write(const std::string &filename) const;
+
+    private:
+        struct PendingEntry {
+            std::string path;
+            std::vector<char> storedData;
+            uint64_t size;
+            AssetPack::Compression compression;
+        };
+
+        std::vector<PendingEntry> entries;
+    };
+
+}
@@ -0,0 +1,246 @@
+#include "CompressedImage.h"
+#include "AssetLoader.h"
+
+#include "Engine/src/core/utils/Logger.h"
+#include "Engine/src/core/utils/STDExtensions.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+namespace ChaosEngine {
+
+    // ------------------------------------ KTX2 Layout ----------------------------------------------------------------
+    // See https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+
+    static constexpr std::array<uint8_t, 12> ktx2Identifier = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB,
+                                                               0x0D, 0x0A, 0x1A, 0x0A};
+    static constexpr size_t ktx2HeaderSize = 80; // Identifier, header and index
+    static constexpr size_t ktx2LevelIndexEntrySize = 24;
+
+    // VkFormat values as stored in the KTX2 header, core/assets does not depend on the Vulkan headers
+    static constexpr uint32_t vkFormatR8Unorm = 9;
+    static constexpr uint32_t vkFormatR8G8B8A8Unorm = 37;
+    static constexpr uint32_t vkFormatBC4UnormBlock = 139;
+    static constexpr uint32_t vkFormatBC5UnormBlock = 141;
+    static constexpr uint32_t vkFormatBC7UnormBlock = 145;
+
+    template<typename T>
+    static T readLE(const std::vector<char> &data, size_t offset) {
+        T value;
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    static void writeLE(std::vector<char> &data, size_t offset, T value) {
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    static ImageFormat getImageFormat(uint32_t vkFormat, const std::string &filename) {
+        switch (vkFormat) {
+            case vkFormatR8Unorm:
+                return ImageFormat::R8;
+            case vkFormatR8G8B8A8Unorm:
+                return ImageFormat::R8G8B8A8;
+            case vkFormatBC4UnormBlock:
+                return ImageFormat::BC4_R;
+            case vkFormatBC5UnormBlock:
+                return ImageFormat::BC5_RG;
+            case vkFormatBC7UnormBlock:
+                return ImageFormat::BC7_RGBA;
+            default:
+                throw std::runtime_error("[KTX2] Unsupported format " + std::to_string(vkFormat) + " in " + filename);
+        }
+    }
+
+    // ------------------------------------ Class Members --------------------------------------------------------------
+
+    CompressedImage::CompressedImage(std::vector<char> &&data, std::vector<Level> &&levels, ImageFormat format)
+            : data(std::move(data)), levels(std::move(levels)), format(format) {
+        assert("A compressed image needs at least one level!" && !CompressedImage::levels.empty());
+    }
+
+    bool CompressedImage::isKTX2File(const std::string &filename) {
+        const auto extension = std::string(".ktx2");
+        return filename.size() > extension.size() &&
+               stringToLower(filename.substr(filename.size() - extension.size())) == extension;
+    }
+
+    static uint32_t getVkFormat(ImageFormat format) {
+        switch (format) {
+            case ImageFormat::R8:
+                return vkFormatR8Unorm;
+            case ImageFormat::R8G8B8A8:
+                return vkFormatR8G8B8A8Unorm;
+            case ImageFormat::BC4_R:
+                return vkFormatBC4UnormBlock;
+            case ImageFormat::BC5_RG:
+                return vkFormatBC5UnormBlock;
+            case ImageFormat::BC7_RGBA:
+                return vkFormatBC7UnormBlock;
+            default:
+                throw std::runtime_error("[KTX2] Format can not be stored in a KTX2 file");
+        }
+    }
+
+    /* Basic data format descriptor for the uncompressed unorm formats, required by the KTX2 specification. */
+    static std::vector<char> createBasicDFD(ImageFormat format) {
+        // See https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html (Khronos Basic Data Format)
+        static constexpr uint32_t colorModelRGBSDA = 1;
+        static constexpr uint32_t colorPrimariesBT709 = 1;
+        static constexpr uint32_t transferLinear = 1;
+        static constexpr uint32_t alphaStraight = 0;
+        static constexpr std::array<uint32_t, 4> channelIds = {0 /* R */, 1 /* G */, 2 /* B */, 15 /* A */};
+
+        const uint32_t sampleCount = format == ImageFormat::R8 ? 1 : 4;
+        const uint32_t blockSize = 24 + 16 * sampleCount;
+        std::vector<char> dfd(4 + blockSize, 0);
+        writeLE<uint32_t>(dfd, 0, static_cast<uint32_t>(dfd.size()));
+        writeLE<uint32_t>(dfd, 4, 0); // Khronos vendor, basic descriptor type
+        writeLE<uint32_t>(dfd, 8, 2 | (blockSize << 16)); // Version 1.3
+        writeLE<uint32_t>(dfd, 12, colorModelRGBSDA | (colorPrimariesBT709 << 8) | (transferLinear << 16) |
+                                   (alphaStraight << 24));
+        writeLE<uint32_t>(dfd, 16, 0); // 1x1x1x1 texel block
+        writeLE<uint32_t>(dfd, 20, sampleCount); // Bytes in plane 0
+        for (uint32_t i = 0; i < sampleCount; ++i) {
+            const size_t sample = 28 + i * 16;
+            writeLE<uint32_t>(dfd, sample, (i * 8) | (7 << 16) | (channelIds[i] << 24)); // Offset, length - 1, channel
+            writeLE<uint32_t>(dfd, sample + 4, 0); // Sample position
+            writeLE<uint32_t>(dfd, sample + 8, 0); // Lower
+            writeLE<uint32_t>(dfd, sample + 12, 255); // Upper
+        }
+        return dfd;
+    }
+
+    bool CompressedImage::isBlockCompressed(ImageFormat format) {
+        return format == ImageFormat::BC4_R || format == ImageFormat::BC5_RG || format == ImageFormat::BC7_RGBA;
+    }
+
+    uint32_t CompressedImage::getBlockSize(ImageFormat format) {
+        switch (format) {
+            case ImageFormat::R8:
+                return 1;
+            case ImageFormat::R8G8B8A8:
+                return 4;
+            case ImageFormat::BC4_R:
+                return 8;
+            case ImageFormat::BC5_RG:
+            case ImageFormat::BC7_RGBA:
+                return 16;
+            default:
+                assert("Format can not be stored in a KTX2 file!" && false);
+                return 0;
+        }
+    }
+
+    CompressedImage CompressedImage::readKTX2(const std::string &filename) {
+        auto data = AssetLoader::loadBinary(filename);
+        if (data.size() < ktx2HeaderSize ||
+            !std::equal(ktx2Identifier.begin(), ktx2Identifier.end(), reinterpret_cast<const uint8_t *>(data.data()))) {
+            throw std::runtime_error("[KTX2] Not a KTX2 file: " + filename);
+        }
+
+        const auto vkFormat = readLE<uint32_t>(data, 12);
+        const auto pixelWidth = readLE<uint32_t>(data, 20);
+        const auto pixelHeight = readLE<uint32_t>(data, 24);
+        const auto pixelDepth = readLE<uint32_t>(data, 28);
+        const auto layerCount = readLE<uint32_t>(data, 32);
+        const auto faceCount = readLE<uint32_t>(data, 36);
+        const auto levelCount = readLE<uint32_t>(data, 40);
+        const auto supercompressionScheme = readLE<uint32_t>(data, 44);
+
+        if (pixelDepth > 1 || layerCount > 1 || faceCount != 1) {
+            throw std::runtime_error("[KTX2] Only single layer 2D textures are supported: " + filename);
+        }
+        if (supercompressionScheme != 0) {
+            throw std::runtime_error("[KTX2] Supercompressed files are not supported: " + filename);
+        }
+        if (pixelHeight == 0) {
+            throw std::runtime_error("[KTX2] 1D textures are not supported: " + filename);
+        }
+        // 0 requests generating the levels at runtime, which only the decoded image path does
+        if (levelCount == 0) {
+            throw std::runtime_error("[KTX2] Files without stored mip levels are not supported: " + filename);
+        }
+        // The full chain of a w x h image has floor(log2(max(w, h))) + 1 levels
+        if (levelCount > static_cast<uint32_t>(std::bit_width(std::max(pixelWidth, pixelHeight)))) {
+            throw std::runtime_error("[KTX2] More mip levels than the image size allows in " + filename);
+        }
+        if (data.size() < ktx2HeaderSize + levelCount * ktx2LevelIndexEntrySize) {
+            throw std::runtime_error("[KTX2] Truncated level index in " + filename);
+        }
+
+        const auto format = getImageFormat(vkFormat, filename);
+        const uint32_t blockSize = getBlockSize(format);
+        const uint32_t blockExtent = getBlockExtent(format);
+
+        std::vector<Level> levels;
+        levels.reserve(levelCount);
+        for (uint32_t i = 0; i < levelCount; ++i) {
+            const size_t entry = ktx2HeaderSize + i * ktx2LevelIndexEntrySize;
+            const Level level{
+                    .offset = readLE<uint64_t>(data, entry),
+                    .size = readLE<uint64_t>(data, entry + 8),
+                    .width = std::max(1u, pixelWidth >> i),
+                    .height = std::max(1u, pixelHeight >> i),
+            };
+            const uint64_t expectedSize = static_cast<uint64_t>((level.width + blockExtent - 1) / blockExtent) *
+                                          ((level.height + blockExtent - 1) / blockExtent) * blockSize;
+            // Written without a sum, a large offset must not wrap around
+            if (level.offset > data.size() || level.size > data.size() - level.offset || level.size < expectedSize) {
+                throw std::runtime_error("[KTX2] Invalid level " + std::to_string(i) + " in " + filename);
+            }
+            levels.emplace_back(level);
+        }
+
+        LOG_DEBUG("[KTX2] Loaded {} ({}x{}, {} levels)", filename, pixelWidth, pixelHeight, levelCount);
+        return CompressedImage{std::move(data), std::move(levels), format};
+    }
+
+    std::vector<char> CompressedImage::writeKTX2(ImageFormat format, uint32_t width, uint32_t height,
+                                                 const std::vector<std::vector<char>> &levels) {
+        assert("A KTX2 file needs at least one level!" && !levels.empty());
+        assert("Only uncompressed formats can be written!" && !isBlockCompressed(format));
+        const auto dfd = createBasicDFD(format);
+
+        // Header and level index, followed by the DFD and the level data from the smallest to the largest level
+        const size_t dfdOffset = ktx2HeaderSize + levels.size() * ktx2LevelIndexEntrySize;
+        size_t fileSize = dfdOffset + dfd.size();
+        std::vector<uint64_t> levelOffsets(levels.size());
+        const uint64_t alignment = std::max(getBlockSize(format), 4u);
+        for (size_t i = levels.size(); i-- > 0;) {
+            fileSize = (fileSize + alignment - 1) / alignment * alignment;
+            levelOffsets[i] = fileSize;
+            fileSize += levels[i].size();
+        }
+
+        std::vector<char> data(fileSize, 0);
+        std::memcpy(data.data(), ktx2Identifier.data(), ktx2Identifier.size());
+        writeLE<uint32_t>(data, 12, getVkFormat(format));
+        writeLE<uint32_t>(data, 16, 1); // Type size
+        writeLE<uint32_t>(data, 20, width);
+        writeLE<uint32_t>(data, 24, height);
+        writeLE<uint32_t>(data, 28, 0); // Depth
+        writeLE<uint32_t>(data, 32, 0); // Layers
+        writeLE<uint32_t>(data, 36, 1); // Faces
+        writeLE<uint32_t>(data, 40, static_cast<uint32_t>(levels.size()));
+        writeLE<uint32_t>(data, 44, 0); // No supercompression
+        writeLE<uint32_t>(data, 48, static_cast<uint32_t>(dfdOffset));
+        writeLE<uint32_t>(data, 52, static_cast<uint32_t>(dfd.size()));
+        // Key/value data and supercompression global data are left empty
+        std::memcpy(data.data() + dfdOffset, dfd.data(), dfd.size());
+        for (size_t i = 0; i < levels.size(); ++i) {
+            const size_t entry = ktx2HeaderSize + i * ktx2LevelIndexEntrySize;
+            writeLE<uint64_t>(data, entry, levelOffsets[i]);
+            writeLE<uint64_t>(data, entry + 8, levels[i].size());
+            writeLE<uint64_t>(data, entry + 16, levels[i].size()); // Uncompressed byte length
+            std::memcpy(data.data() + levelOffsets[i], levels[i].data(), levels[i].size());
+        }
+        return data;
+    }
+
+}
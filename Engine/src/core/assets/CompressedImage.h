@@ -0,0 +1,74 @@
+#pragma once
+
+#include "RawImage.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace ChaosEngine {
+
+    /**
+     * A GPU ready image with its complete mip chain as stored in a KTX2 file, either block compressed or an uncompressed
+     * one produced by the asset cooker. The payload is uploaded as is, there is no CPU side conversion.
+     */
+    class CompressedImage {
+    public:
+        struct Level {
+            uint64_t offset; // Into getData()
+            uint64_t size;
+            uint32_t width;
+            uint32_t height;
+        };
+
+    public:
+        CompressedImage(std::vector<char> &&data, std::vector<Level> &&levels, ImageFormat format);
+
+        ~CompressedImage() = default;
+
+        CompressedImage(const CompressedImage &o) = delete;
+
+        CompressedImage &operator=(const CompressedImage &o) = delete;
+
+        CompressedImage(CompressedImage &&o) noexcept = default;
+
+        CompressedImage &operator=(CompressedImage &&o) noexcept = default;
+
+// ----------------------------- Static Create Functions ---------------------------------------------------------------
+
+        /// Reads a KTX2 file without supercompression containing a R8, R8G8B8A8, BC4, BC5 or BC7 payload, the mip levels
+        /// MUST be stored in the file. Throws on malformed files.
+        static CompressedImage readKTX2(const std::string &filename);
+
+        /// Serializes the levels into a KTX2 file, levels MUST be tightly packed and ordered from the largest one
+        static std::vector<char> writeKTX2(ImageFormat format, uint32_t width, uint32_t height,
+                                           const std::vector<std::vector<char>> &levels);
+
+        static bool isKTX2File(const std::string &filename);
+
+        static bool isBlockCompressed(ImageFormat format);
+
+        /// Bytes per block, 4x4 pixels for block compressed formats and a single pixel otherwise
+        static uint32_t getBlockSize(ImageFormat format);
+
+        static uint32_t getBlockExtent(ImageFormat format) { return isBlockCompressed(format) ? 4 : 1; }
+
+// ------------------------------------ Class Members ------------------------------------------------------------------
+
+        [[nodiscard]] const char *getData() const { return data.data(); }
+
+        [[nodiscard]] const std::vector<Level> &getLevels() const { return levels; }
+
+        [[nodiscard]] uint32_t getWidth() const { return levels[0].width; }
+
+        [[nodiscard]] uint32_t getHeight() const { return levels[0].height; }
+
+        [[nodiscard]] ImageFormat getFormat() const { return format; }
+
+    private:
+        std::vector<char> data; // Complete file content
+        std::vector<Level> levels; // Level 0 is the most detailed one
+        ImageFormat format;
+    };
+
+}
@@ -0,0 +1,32 @@
+#include "CookedAssets.h"
+#include "AssetLoader.h"
+
+#include <cmath>
+
+namespace ChaosEngine::CookedAssets {
+
+    std::string getTexturePath(const std::string &source) {
+        return source + ".ktx2";
+    }
+
+    std::string getMeshPath(const std::string &source) {
+        return source + ".cmesh";
+    }
+
+    std::string getAudioPath(const std::string &source) {
+        return source + ".pcm";
+    }
+
+    std::string getFontPath(const std::string &source, double size, double resolution) {
+        // Fixed point, so the name does not depend on float formatting
+        const auto toFixed = [](double value) { return std::to_string(std::lround(value * 100.0)); };
+        return source + "." + toFixed(size) + "_" + toFixed(resolution) + ".cfont";
+    }
+
+    std::optional<std::string> findCooked(const std::string &cookedPath) {
+        if (AssetLoader::exists(cookedPath))
+            return cookedPath;
+        return std::nullopt;
+    }
+
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * Naming and binary helpers shared between the offline asset cooker and the runtime loaders.
+ * Cooked outputs live next to their source, e.g. "textures/TestAtlas.jpg" is cooked to "textures/TestAtlas.jpg.ktx2".
+ * The loaders prefer a cooked output whenever the AssetLoader can find one.
+ */
+namespace ChaosEngine::CookedAssets {
+
+    /// Bumped whenever a cooked format changes, forces the cooker to rebuild everything
+    constexpr uint32_t formatVersion = 1;
+
+    std::string getTexturePath(const std::string &source);
+
+    std::string getMeshPath(const std::string &source);
+
+    std::string getAudioPath(const std::string &source);
+
+    /// Font atlases are rasterized for one size and resolution, both are part of the name
+    std::string getFontPath(const std::string &source, double size, double resolution);
+
+    /// Returns the cooked path if it can be loaded through the AssetLoader
+    std::optional<std::string> findCooked(const std::string &cookedPath);
+
+    class BinaryWriter {
+    public:
+        /// Every cooked file starts with a 4 character magic followed by the format version
+        void writeHeader(const char (&magic)[5]) {
+            writeBytes(magic, 4);
+            write(formatVersion);
+        }
+
+        template<typename T>
+        void write(const T &value) {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written!");
+            writeBytes(&value, sizeof(T));
+        }
+
+        void writeBytes(const void *source, size_t size) {
+            const auto *bytes = static_cast<const char *>(source);
+            data.insert(data.end(), bytes, bytes + size);
+        }
+
+        [[nodiscard]] std::vector<char> &getData() { return data; }
+
+    private:
+        std::vector<char> data;
+    };
+
+    class BinaryReader {
+    public:
+        BinaryReader(const std::vector<char> &data, const std::string &name) : data(data), name(name) {}
+
+        void readHeader(const char (&magic)[5]) {
+            char fileMagic[4];
+            readBytes(fileMagic, 4);
+            if (std::memcmp(fileMagic, magic, 4) != 0)
+                throw std::runtime_error("[CookedAssets] Unexpected file type of " + name);
+            if (read<uint32_t>() != formatVersion)
+                throw std::runtime_error("[CookedAssets] Outdated cooked asset " + name + ", re-run the asset cooker");
+        }
+
+        template<typename T>
+        T read() {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read!");
+            T value;
+            readBytes(&value, sizeof(T));
+            return value;
+        }
+
+        void readBytes(void *destination, size_t size) {
+            if (size > data.size() - offset)
+                throw std::runtime_error("[CookedAssets] Truncated cooked asset " + name);
+            std::memcpy(destination, data.data() + offset, size);
+            offset += size;
+        }
+
+    private:
+        const std::vector<char> &data;
+        const std::string name;
+        size_t offset = 0;
+    };
+
+}
@@ -6,6 +6,7 @@
 
 #include "Engine/src/renderer/api/Texture.h"
 #include "Engine/src/core/assets/AssetLoader.h"
+#include "Engine/src/core/assets/CookedAssets.h"
 #include "Engine/src/core/utils/Logger.h"
 
 using namespace ChaosEngine;
@@ -31,11 +32,26 @@ Font::Create(FT_Library &freetype, const std::string &name, const std::string &t
              double size, double resolution) {
     LOG_INFO("Loading Font from {}, with style {} and size {}pt", ttfFile.c_str(), style, size);
 
+    const auto cooked = CookedAssets::findCooked(CookedAssets::getFontPath(ttfFile, size, resolution));
+    auto atlas = cooked ? readCookedAtlas(*cooked) : Rasterize(freetype, ttfFile, size, resolution);
+
+    using namespace Renderer;
+    auto fontTexture = Texture::Create(RawImage(std::move(atlas.bitmap), atlas.width, atlas.width,
+                                                atlas.width * atlas.width, ImageFormat::R8), ttfFile);
+
+    return std::make_shared<Font>(name, style, size, resolution, atlas.lineHeight,
+                                  std::move(atlas.glyphs), std::move(fontTexture));
+}
+
+Font::Atlas Font::Rasterize(FT_Library &freetype, const std::string &ttfFile, double size, double resolution) {
     const double pixelSize = size * resolution / 72;
     const int padding = 16;
 
+    // FreeType reads from this buffer until the face is destroyed
+    const auto fontData = AssetLoader::loadBinary(ttfFile);
     FT_Face face;
-    if (FT_New_Face(freetype, ttfFile.c_str(), 0, &face)) {
+    if (FT_New_Memory_Face(freetype, reinterpret_cast<const FT_Byte *>(fontData.data()),
+                           static_cast<FT_Long>(fontData.size()), 0, &face)) {
         throw std::runtime_error("ERROR::FREETYPE: Failed to load font");
     }
     const auto toPixelCoord = [=](double coord) { return coord * pixelSize / face->units_per_EM; };
@@ -141,10 +157,43 @@ Font::Create(FT_Library &freetype, const std::string &name, const std::string &t
 
     FT_Done_Face(face);
 
-    using namespace Renderer;
-    auto fontTexture = Texture::Create(RawImage(std::move(mapBuffer), width, width, width * width, ImageFormat::R8),
-                                       ttfFile);
+    return Atlas{width, lineHeight, std::move(charGlyphs), std::move(mapBuffer)};
+}
+
+// ------------------------------------ Cooked Atlases -----------------------------------------------------------------
 
-    return std::make_shared<Font>(name, style, size, resolution, lineHeight,
-                                  std::move(charGlyphs), std::move(fontTexture));
+static constexpr char cookedFontMagic[5] = "CEFT";
+
+Font::Atlas Font::readCookedAtlas(const std::string &filename) {
+    const auto data = AssetLoader::loadBinary(filename);
+    CookedAssets::BinaryReader reader(data, filename);
+    reader.readHeader(cookedFontMagic);
+
+    Atlas atlas{};
+    atlas.width = reader.read<uint32_t>();
+    atlas.lineHeight = reader.read<double>();
+    const auto glyphCount = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < glyphCount; ++i) {
+        const auto character = reader.read<uint32_t>();
+        atlas.glyphs.insert_or_assign(character, reader.read<CharacterGlyph>());
+    }
+    atlas.bitmap.reset(new unsigned char[atlas.width * atlas.width]);
+    reader.readBytes(atlas.bitmap.get(), atlas.width * atlas.width);
+
+    LOG_DEBUG("Loaded cooked font atlas {} with {} glyphs", filename, glyphCount);
+    return atlas;
+}
+
+std::vector<char> Font::writeCookedAtlas(const Atlas &atlas) {
+    CookedAssets::BinaryWriter writer;
+    writer.writeHeader(cookedFontMagic);
+    writer.write(atlas.width);
+    writer.write(atlas.lineHeight);
+    writer.write(static_cast<uint32_t>(atlas.glyphs.size()));
+    for (const auto &[character, glyph]: atlas.glyphs) {
+        writer.write(character);
+        writer.write(glyph);
+    }
+    writer.writeBytes(atlas.bitmap.get(), atlas.width * atlas.width);
+    return std::move(writer.getData());
 }
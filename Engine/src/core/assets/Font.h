@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "renderer/api/Texture.h"
 
@@ -29,6 +30,14 @@ namespace ChaosEngine {
             glm::vec2 bearing;
             float advance;
         };
+
+        /// All glyphs rasterized into a single channel atlas, the CPU side part of a font which can be cooked offline.
+        struct Atlas {
+            uint32_t width; // The atlas is square
+            double lineHeight;
+            std::unordered_map<uint32_t, CharacterGlyph> glyphs;
+            std::unique_ptr<unsigned char[]> bitmap;
+        };
     public:
         Font(const std::string &name, FontStyle style, double size, double resolution, double lineHeight,
              std::unordered_map<uint32_t, CharacterGlyph> &&glyphs, std::unique_ptr<Renderer::Texture> &&fontTex)
@@ -53,9 +62,15 @@ namespace ChaosEngine {
 
         [[nodiscard]] Renderer::Texture const *getFontTexture() const { return fontTex.get(); };
 
+        static Atlas Rasterize(FT_Library &freetype, const std::string &ttfFile, double size, double resolution);
+
+        static Atlas readCookedAtlas(const std::string &filename);
+
+        static std::vector<char> writeCookedAtlas(const Atlas &atlas);
+
     private:
         // ------------------------------------ Creator ----------------------------------------------------------------
-        /// Creates a new font, should be called by the FontManager.
+        /// Creates a new font, should be called by the FontManager. Uses the cooked atlas if available.
         static std::shared_ptr<Font> Create(FT_Library &freetype, const std::string &name,
                                             const std::string &ttfFile, FontStyle style,
                                             double size, double resolution);
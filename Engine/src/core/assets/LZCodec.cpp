@@ -0,0 +1,143 @@
+#include "LZCodec.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace ChaosEngine::LZCodec {
+
+    // Sequence layout: token (4 bit literal length | 4 bit match length - minMatch), optional literal length bytes,
+    // literals, 16 bit offset, optional match length bytes. The last sequence only contains literals.
+    static constexpr size_t minMatch = 4;
+    static constexpr size_t lastLiterals = 5; // The block always ends with literals
+    static constexpr size_t maxOffset = 0xFFFF;
+    static constexpr uint32_t hashBits = 16;
+
+    static inline uint32_t read32(const uint8_t *p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    static inline uint32_t hashSequence(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - hashBits);
+    }
+
+    static void writeLength(std::vector<uint8_t> &out, size_t length) {
+        for (; length >= 255; length -= 255) {
+            out.push_back(255);
+        }
+        out.push_back(static_cast<uint8_t>(length));
+    }
+
+    static void writeSequence(std::vector<uint8_t> &out, const uint8_t *literals, size_t literalLength,
+                              size_t offset, size_t matchLength) {
+        const size_t matchCode = matchLength - minMatch;
+        const auto token = static_cast<uint8_t>(((literalLength >= 15 ? 15 : literalLength) << 4) |
+                                                (matchCode >= 15 ? 15 : matchCode));
+        out.push_back(token);
+        if (literalLength >= 15)
+            writeLength(out, literalLength - 15);
+        out.insert(out.end(), literals, literals + literalLength);
+        out.push_back(static_cast<uint8_t>(offset & 0xFF));
+        out.push_back(static_cast<uint8_t>(offset >> 8));
+        if (matchCode >= 15)
+            writeLength(out, matchCode - 15);
+    }
+
+    static void writeLastLiterals(std::vector<uint8_t> &out, const uint8_t *literals, size_t literalLength) {
+        out.push_back(static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4));
+        if (literalLength >= 15)
+            writeLength(out, literalLength - 15);
+        out.insert(out.end(), literals, literals + literalLength);
+    }
+
+    std::vector<char> compress(const char *source, size_t size) {
+        const auto *src = reinterpret_cast<const uint8_t *>(source);
+        std::vector<uint8_t> out;
+        out.reserve(size + size / 255 + 16);
+
+        std::vector<int64_t> table(size_t(1) << hashBits, -1);
+        size_t anchor = 0;
+        size_t pos = 0;
+        const size_t matchLimit = size > lastLiterals ? size - lastLiterals : 0;
+        while (pos + minMatch <= matchLimit) {
+            const uint32_t sequence = read32(src + pos);
+            const uint32_t hash = hashSequence(sequence);
+            const int64_t candidate = table[hash];
+            table[hash] = static_cast<int64_t>(pos);
+
+            if (candidate >= 0 && pos - candidate <= maxOffset && read32(src + candidate) == sequence) {
+                size_t matchLength = minMatch;
+                while (pos + matchLength < matchLimit && src[candidate + matchLength] == src[pos + matchLength]) {
+                    ++matchLength;
+                }
+                writeSequence(out, src + anchor, pos - anchor, pos - candidate, matchLength);
+                pos += matchLength;
+                anchor = pos;
+            } else {
+                // Skip faster through data which does not compress
+                pos += 1 + ((pos - anchor) >> 6);
+            }
+        }
+        writeLastLiterals(out, src + anchor, size - anchor);
+
+        return {out.begin(), out.end()};
+    }
+
+    static inline bool readLength(const uint8_t *&in, const uint8_t *end, size_t &length) {
+        uint8_t value;
+        do {
+            if (in >= end)
+                return false;
+            value = *in++;
+            length += value;
+        } while (value == 255);
+        return true;
+    }
+
+    bool decompress(const char *source, size_t size, char *destination, size_t decompressedSize) {
+        const auto *in = reinterpret_cast<const uint8_t *>(source);
+        const uint8_t *inEnd = in + size;
+        auto *out = reinterpret_cast<uint8_t *>(destination);
+        uint8_t *outStart = out;
+        uint8_t *outEnd = out + decompressedSize;
+
+        while (in < inEnd) {
+            const uint8_t token = *in++;
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !readLength(in, inEnd, literalLength))
+                return false;
+            if (literalLength > static_cast<size_t>(inEnd - in) || literalLength > static_cast<size_t>(outEnd - out))
+                return false;
+            if (literalLength > 0)
+                std::memcpy(out, in, literalLength);
+            in += literalLength;
+            out += literalLength;
+
+            if (in == inEnd)
+                break; // Last sequence
+
+            if (inEnd - in < 2)
+                return false;
+            const size_t offset = in[0] | (in[1] << 8);
+            in += 2;
+            if (offset == 0 || offset > static_cast<size_t>(out - outStart))
+                return false;
+            size_t matchLength = token & 0x0F;
+            if (matchLength == 15 && !readLength(in, inEnd, matchLength))
+                return false;
+            matchLength += minMatch;
+            if (matchLength > static_cast<size_t>(outEnd - out))
+                return false;
+
+            // Byte wise copy, the match may overlap with its own output
+            const uint8_t *match = out - offset;
+            for (size_t i = 0; i < matchLength; ++i) {
+                out[i] = match[i];
+            }
+            out += matchLength;
+        }
+        return out == outEnd;
+    }
+
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * Small byte oriented LZ77 codec (LZ4 style sequences) used for asset pack entries.
+ * Favours decompression speed over ratio, decompression is a tight copy loop without entropy decoding.
+ */
+namespace ChaosEngine::LZCodec {
+
+    std::vector<char> compress(const char *source, size_t size);
+
+    /// Decompresses into destination which MUST be exactly decompressedSize bytes, returns false on corrupt input
+    bool decompress(const char *source, size_t size, char *destination, size_t decompressedSize);
+
+}
@@ -32,4 +32,12 @@ namespace std {
         hash_combine(value, hash<glm::vec4>()(vertex.color));
         return value;
     }
+
+    size_t hash<VertexPacked2D>::operator()(VertexPacked2D const &vertex) const noexcept {
+        size_t value = 0;
+        hash_combine(value, hash<glm::u16vec2>()(vertex.pos));
+        hash_combine(value, hash<glm::u8vec4>()(vertex.color));
+        hash_combine(value, hash<glm::u16vec2>()(vertex.uv));
+        return value;
+    }
 }
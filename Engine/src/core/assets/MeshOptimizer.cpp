@@ -0,0 +1,278 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+// ------------------------------------ Vertex Cache Optimization ------------------------------------------------------
+// Based on Tom Forsyth's "Linear-Speed Vertex Cache Optimisation"
+
+namespace {
+    constexpr size_t cacheSize = 32;
+    constexpr float cacheDecayPower = 1.5f;
+    constexpr float lastTriangleScore = 0.75f;
+    constexpr float valenceBoostScale = 2.0f;
+    constexpr float valenceBoostPower = 0.5f;
+
+    float vertexScore(int cachePosition, uint32_t remainingValence) {
+        if (remainingValence == 0)
+            return -1.0f; // No triangle needs this vertex anymore
+
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3) {
+                // Vertices of the last triangle get a fixed score to avoid favouring strips
+                score = lastTriangleScore;
+            } else {
+                const float scaler = 1.0f / static_cast<float>(cacheSize - 3);
+                score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, cacheDecayPower);
+            }
+        }
+        // Boost vertices with only a few triangles left, to get rid of lone triangles early
+        score += valenceBoostScale * std::pow(static_cast<float>(remainingValence), -valenceBoostPower);
+        return score;
+    }
+}
+
+void MeshOptimizer::optimizeVertexCache(std::vector<uint32_t> &indices, size_t vertexCount) {
+    assert("Index count MUST be a multiple of 3!" && indices.size() % 3 == 0);
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return;
+
+    // Vertex to triangle adjacency
+    std::vector<uint32_t> valence(vertexCount, 0);
+    for (auto index: indices) {
+        assert("Index out of range!" && index < vertexCount);
+        valence[index]++;
+    }
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        adjacencyOffset[v + 1] = adjacencyOffset[v] + valence[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    {
+        std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (size_t i = 0; i < indices.size(); ++i) {
+            adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> score(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        score[v] = vertexScore(-1, valence[v]);
+    }
+    std::vector<float> triangleScore(triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        triangleScore[t] = score[indices[t * 3]] + score[indices[t * 3 + 1]] + score[indices[t * 3 + 2]];
+    }
+    std::vector<bool> emitted(triangleCount, false);
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+
+    size_t scanCursor = 0;
+    auto bestTriangle = static_cast<size_t>(std::max_element(triangleScore.begin(), triangleScore.end()) -
+                                            triangleScore.begin());
+    for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+        if (bestTriangle == triangleCount) {
+            // No candidate in the cache, continue with the next triangle in input order
+            while (emitted[scanCursor]) ++scanCursor;
+            bestTriangle = scanCursor;
+        }
+
+        const uint32_t *tri = &indices[bestTriangle * 3];
+        result.insert(result.end(), tri, tri + 3);
+        emitted[bestTriangle] = true;
+
+        // Remove the triangle from the remaining adjacency of its vertices
+        for (int k = 0; k < 3; ++k) {
+            const uint32_t v = tri[k];
+            uint32_t *begin = &adjacency[adjacencyOffset[v]];
+            uint32_t *end = begin + valence[v];
+            auto it = std::find(begin, end, static_cast<uint32_t>(bestTriangle));
+            std::swap(*it, *(end - 1));
+            valence[v]--;
+        }
+
+        // Move the triangles vertices to the front of the LRU cache
+        newCache.assign(tri, tri + 3);
+        for (auto v: cache) {
+            if (v != tri[0] && v != tri[1] && v != tri[2])
+                newCache.push_back(v);
+        }
+        for (size_t i = 0; i < newCache.size(); ++i) {
+            cachePosition[newCache[i]] = i < cacheSize ? static_cast<int>(i) : -1;
+        }
+        std::swap(cache, newCache);
+
+        // Rescore all vertices which were touched, including the ones dropped from the cache
+        for (auto v: cache) {
+            score[v] = vertexScore(cachePosition[v], valence[v]);
+        }
+        bestTriangle = triangleCount;
+        float bestScore = -1.0f;
+        for (auto v: cache) {
+            for (uint32_t a = adjacencyOffset[v]; a < adjacencyOffset[v] + valence[v]; ++a) {
+                const uint32_t t = adjacency[a];
+                triangleScore[t] = score[indices[t * 3]] + score[indices[t * 3 + 1]] + score[indices[t * 3 + 2]];
+                if (triangleScore[t] > bestScore) {
+                    bestScore = triangleScore[t];
+                    bestTriangle = t;
+                }
+            }
+        }
+        if (cache.size() > cacheSize)
+            cache.resize(cacheSize);
+    }
+
+    indices = std::move(result);
+}
+
+// ------------------------------------ Vertex Fetch Optimization ------------------------------------------------------
+
+MeshOptimizer::VertexRemap
+MeshOptimizer::buildVertexFetchRemap(const std::vector<uint32_t> &indices, size_t vertexCount) {
+    VertexRemap remap{std::vector<uint32_t>(vertexCount, unusedVertex), 0};
+    for (auto index: indices) {
+        if (remap.newIndex[index] == unusedVertex)
+            remap.newIndex[index] = remap.vertexCount++;
+    }
+    return remap;
+}
+
+// ------------------------------------ Simplification -----------------------------------------------------------------
+
+std::vector<uint32_t>
+MeshOptimizer::simplify(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices,
+                        uint32_t gridResolution) {
+    assert("Grid resolution MUST be at least 1!" && gridResolution > 0);
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    for (auto index: indices) {
+        min = glm::min(min, positions[index]);
+        max = glm::max(max, positions[index]);
+    }
+    const glm::vec3 extent = max - min;
+    const float cellSize = std::max(std::max(extent.x, extent.y), extent.z) / static_cast<float>(gridResolution);
+    if (cellSize <= 0.0f)
+        return indices;
+
+    // Assign every vertex to its cell and accumulate the cell centroids
+    const auto cellOf = [&](const glm::vec3 &p) {
+        const glm::uvec3 cell = glm::min(glm::uvec3((p - min) / cellSize), glm::uvec3(gridResolution - 1));
+        return (static_cast<uint64_t>(cell.z) * gridResolution + cell.y) * gridResolution + cell.x;
+    };
+    struct Cell {
+        glm::vec3 centroid{0.0f};
+        uint32_t count = 0;
+        uint32_t representative = unusedVertex;
+        float distance = std::numeric_limits<float>::max();
+    };
+    std::unordered_map<uint64_t, Cell> cells;
+    std::vector<uint64_t> vertexCell(positions.size(), 0);
+    std::vector<bool> visited(positions.size(), false);
+    for (auto index: indices) {
+        if (visited[index]) continue;
+        visited[index] = true;
+        vertexCell[index] = cellOf(positions[index]);
+        auto &cell = cells[vertexCell[index]];
+        cell.centroid += positions[index];
+        cell.count++;
+    }
+    for (auto &[key, cell]: cells) {
+        cell.centroid /= static_cast<float>(cell.count);
+    }
+
+    // The vertex closest to the centroid represents the cell, so no new vertices are needed
+    for (size_t v = 0; v < positions.size(); ++v) {
+        if (!visited[v]) continue;
+        auto &cell = cells[vertexCell[v]];
+        const glm::vec3 delta = positions[v] - cell.centroid;
+        const float distance = glm::dot(delta, delta);
+        if (distance < cell.distance) {
+            cell.distance = distance;
+            cell.representative = static_cast<uint32_t>(v);
+        }
+    }
+
+    std::vector<uint32_t> simplified;
+    simplified.reserve(indices.size());
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        const uint32_t a = cells[vertexCell[indices[i]]].representative;
+        const uint32_t b = cells[vertexCell[indices[i + 1]]].representative;
+        const uint32_t c = cells[vertexCell[indices[i + 2]]].representative;
+        if (a == b || b == c || a == c)
+            continue; // Collapsed
+        simplified.push_back(a);
+        simplified.push_back(b);
+        simplified.push_back(c);
+    }
+    return simplified;
+}
+
+void MeshOptimizer::buildLODs(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices,
+                              const Options &options, std::vector<uint32_t> &combinedIndices,
+                              std::vector<MeshLOD> &lods) {
+    std::vector<uint32_t> lod0 = indices;
+    if (options.optimizeVertexCache)
+        optimizeVertexCache(lod0, positions.size());
+    combinedIndices = lod0;
+    lods.push_back(MeshLOD{0, static_cast<uint32_t>(lod0.size()), 0.0f});
+
+    // Start with roughly one cell per vertex along the longest axis and halve the resolution for every LOD
+    auto resolution = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(positions.size()))));
+    size_t previousCount = lod0.size();
+    float screenSize = options.lodScreenSize;
+    for (uint32_t level = 1; level < options.lodCount; ++level) {
+        resolution = std::max(1u, resolution / 2);
+        auto lod = simplify(positions, lod0, resolution);
+        if (lod.size() / 3 < options.minLodTriangles || lod.size() >= previousCount)
+            break;
+        if (options.optimizeVertexCache)
+            optimizeVertexCache(lod, positions.size());
+
+        lods.back().minScreenSize = screenSize;
+        lods.push_back(MeshLOD{static_cast<uint32_t>(combinedIndices.size()), static_cast<uint32_t>(lod.size()),
+                               0.0f});
+        combinedIndices.insert(combinedIndices.end(), lod.begin(), lod.end());
+        previousCount = lod.size();
+        screenSize *= 0.5f;
+    }
+}
+
+// ------------------------------------ Index Packing ------------------------------------------------------------------
+
+IndexFormat MeshOptimizer::getIndexFormat(size_t vertexCount) {
+    return vertexCount <= std::numeric_limits<uint16_t>::max() ? IndexFormat::UInt16 : IndexFormat::UInt32;
+}
+
+std::vector<uint8_t> MeshOptimizer::packIndices(const std::vector<uint32_t> &indices, IndexFormat format) {
+    std::vector<uint8_t> data(indices.size() * getIndexSize(format));
+    if (format == IndexFormat::UInt32) {
+        std::memcpy(data.data(), indices.data(), data.size());
+    } else {
+        auto *packed = reinterpret_cast<uint16_t *>(data.data());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            assert("Index does not fit into 16 bit!" && indices[i] <= std::numeric_limits<uint16_t>::max());
+            packed[i] = static_cast<uint16_t>(indices[i]);
+        }
+    }
+    return data;
+}
+
+float MeshOptimizer::calculateBoundingRadius(const std::vector<glm::vec3> &positions) {
+    float radiusSquared = 0.0f;
+    for (const auto &p: positions) {
+        radiusSquared = std::max(radiusSquared, glm::dot(p, p));
+    }
+    return std::sqrt(radiusSquared);
+}
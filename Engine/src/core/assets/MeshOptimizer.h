@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Mesh.h"
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * Post import optimization stage for meshes.
+ * Reorders triangles for the post transform vertex cache, reorders vertices for linear fetches, generates simplified
+ * LOD index buffers sharing the same vertex buffer and packs the indices into 16 bit whenever possible.
+ */
+class MeshOptimizer {
+public:
+    struct Options {
+        bool optimizeVertexCache = true;
+        bool optimizeVertexFetch = true;
+        /// Number of LODs including the full detail one
+        uint32_t lodCount = 3;
+        /// Projected size below which the first simplified LOD is used, halved for every further LOD
+        float lodScreenSize = 0.25f;
+        /// LODs stop being generated once the simplified mesh has fewer triangles than this
+        uint32_t minLodTriangles = 16;
+    };
+
+public:
+    MeshOptimizer() = delete;
+
+    template<typename Vertex>
+    static OptimizedMesh<Vertex>
+    optimize(const std::vector<Vertex> &vertices, const std::vector<uint32_t> &indices, const Options &options) {
+        std::vector<glm::vec3> positions;
+        positions.reserve(vertices.size());
+        for (const auto &vertex: vertices) {
+            positions.emplace_back(vertex.pos);
+        }
+
+        std::vector<uint32_t> combinedIndices;
+        std::vector<MeshLOD> lods;
+        buildLODs(positions, indices, options, combinedIndices, lods);
+
+        OptimizedMesh<Vertex> mesh;
+        if (options.optimizeVertexFetch) {
+            const auto remap = buildVertexFetchRemap(combinedIndices, vertices.size());
+            mesh.vertices.resize(remap.vertexCount);
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                if (remap.newIndex[i] != unusedVertex)
+                    mesh.vertices[remap.newIndex[i]] = vertices[i];
+            }
+            for (auto &index: combinedIndices) {
+                index = remap.newIndex[index];
+            }
+        } else {
+            mesh.vertices = vertices;
+        }
+
+        mesh.indexFormat = getIndexFormat(mesh.vertices.size());
+        mesh.indexData = packIndices(combinedIndices, mesh.indexFormat);
+        mesh.indexCount = static_cast<uint32_t>(combinedIndices.size());
+        mesh.lods = std::move(lods);
+        mesh.boundingRadius = calculateBoundingRadius(positions);
+        return mesh;
+    }
+
+    static OptimizedMesh<VertexPNCU> optimize(const MeshPNCU &mesh, const Options &options) {
+        return optimize(mesh.vertices, mesh.indices, options);
+    }
+
+    static OptimizedMesh<VertexPCU> optimize(const MeshPCU &mesh, const Options &options) {
+        return optimize(mesh.vertices, mesh.indices, options);
+    }
+
+    /// Reorders the triangles in place to maximize post transform vertex cache hits (Forsyth's algorithm).
+    static void optimizeVertexCache(std::vector<uint32_t> &indices, size_t vertexCount);
+
+    /// Creates a coarser version of the triangle list by clustering vertices on a uniform grid.
+    static std::vector<uint32_t>
+    simplify(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices, uint32_t gridResolution);
+
+    static IndexFormat getIndexFormat(size_t vertexCount);
+
+    static std::vector<uint8_t> packIndices(const std::vector<uint32_t> &indices, IndexFormat format);
+
+private:
+    static constexpr uint32_t unusedVertex = UINT32_MAX;
+
+    struct VertexRemap {
+        std::vector<uint32_t> newIndex;
+        uint32_t vertexCount;
+    };
+
+    static void buildLODs(const std::vector<glm::vec3> &positions, const std::vector<uint32_t> &indices,
+                          const Options &options, std::vector<uint32_t> &combinedIndices, std::vector<MeshLOD> &lods);
+
+    /// Assigns new vertex indices in order of first use, unreferenced vertices get dropped.
+    static VertexRemap buildVertexFetchRemap(const std::vector<uint32_t> &indices, size_t vertexCount);
+
+    static float calculateBoundingRadius(const std::vector<glm::vec3> &positions);
+};
@@ -1,6 +1,9 @@
 #include "ModelLoader.h"
 
+#include "CookedAssets.h"
+#include "AssetLoader.h"
 #include "Engine/src/core/utils/Logger.h"
+#include "Engine/src/core/utils/STDExtensions.h"
 
 #define TINYOBJLOADER_IMPLEMENTATION
 
@@ -283,6 +286,59 @@ std::optional<std::unique_ptr<MeshPNCU>> ModelLoader::loadMeshFromPLY(const std:
     }
 }
 
+OptimizedMesh<VertexPNCU>
+ModelLoader::loadOptimizedMesh(const std::string &filename, const MeshOptimizer::Options &options) {
+    if (const auto cooked = ChaosEngine::CookedAssets::findCooked(ChaosEngine::CookedAssets::getMeshPath(filename)))
+        return readCookedMesh(*cooked);
+
+    const auto extension = ChaosEngine::stringToLower(filename.substr(filename.find_last_of('.') + 1));
+    auto mesh = extension == "ply" ? loadMeshFromPLY(filename) : loadMeshFromOBJ(filename);
+    if (!mesh)
+        throw std::runtime_error("[ModelLoader] Failed to load mesh " + filename);
+    return MeshOptimizer::optimize(**mesh, options);
+}
+
+// ------------------------------------ Cooked Meshes ------------------------------------------------------------------
+
+static constexpr char cookedMeshMagic[5] = "CEMS";
+
+OptimizedMesh<VertexPNCU> ModelLoader::readCookedMesh(const std::string &filename) {
+    const auto data = ChaosEngine::AssetLoader::loadBinary(filename);
+    ChaosEngine::CookedAssets::BinaryReader reader(data, filename);
+    reader.readHeader(cookedMeshMagic);
+
+    OptimizedMesh<VertexPNCU> mesh;
+    mesh.vertices.resize(reader.read<uint32_t>());
+    mesh.indexFormat = reader.read<IndexFormat>();
+    mesh.indexCount = reader.read<uint32_t>();
+    mesh.indexData.resize(static_cast<size_t>(mesh.indexCount) * getIndexSize(mesh.indexFormat));
+    mesh.lods.resize(reader.read<uint32_t>());
+    mesh.boundingRadius = reader.read<float>();
+    reader.readBytes(mesh.vertices.data(), mesh.vertices.size() * sizeof(VertexPNCU));
+    reader.readBytes(mesh.indexData.data(), mesh.indexData.size());
+    reader.readBytes(mesh.lods.data(), mesh.lods.size() * sizeof(MeshLOD));
+
+    LOG_DEBUG("[ModelLoader] Loaded cooked mesh {} with {} vertices and {} LODs", filename, mesh.vertices.size(),
+              mesh.lods.size());
+    return mesh;
+}
+
+std::vector<char> ModelLoader::writeCookedMesh(const OptimizedMesh<VertexPNCU> &mesh) {
+    ChaosEngine::CookedAssets::BinaryWriter writer;
+    writer.writeHeader(cookedMeshMagic);
+    writer.write(static_cast<uint32_t>(mesh.vertices.size()));
+    writer.write(mesh.indexFormat);
+    writer.write(mesh.indexCount);
+    writer.write(static_cast<uint32_t>(mesh.lods.size()));
+    writer.write(mesh.boundingRadius);
+    writer.writeBytes(mesh.vertices.data(), mesh.vertices.size() * sizeof(VertexPNCU));
+    writer.writeBytes(mesh.indexData.data(), mesh.indexData.size());
+    writer.writeBytes(mesh.lods.data(), mesh.lods.size() * sizeof(MeshLOD));
+    return std::move(writer.getData());
+}
+
+// ------------------------------------ Shapes -------------------------------------------------------------------------
+
 MeshPNCU ModelLoader::getQuad_PNCU() {
     const std::vector<VertexPNCU> vertices = {
             VertexPNCU{.pos{-1.0f, -1.0f, +0.0f}, .color{1.0f, 1.0f, 1.0f},
@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "Mesh.h"
+#include "MeshOptimizer.h"
 
 // TODO: Refactor
 class ModelLoader {
@@ -25,6 +26,16 @@ public:
 
     static std::optional<std::unique_ptr<MeshPNCU>> loadMeshFromPLY(const std::string &filename);
 
+    /// Loads an OBJ or PLY model ready for upload, preferring the output of the asset cooker if available.
+    static OptimizedMesh<VertexPNCU>
+    loadOptimizedMesh(const std::string &filename, const MeshOptimizer::Options &options = {});
+
+// ------------------------------------ Cooked Meshes ------------------------------------------------------------------
+
+    static OptimizedMesh<VertexPNCU> readCookedMesh(const std::string &filename);
+
+    static std::vector<char> writeCookedMesh(const OptimizedMesh<VertexPNCU> &mesh);
+
 // ------------------------------------ Shapes -------------------------------------------------------------------------
 
     static MeshPNCU getQuad_PNCU();
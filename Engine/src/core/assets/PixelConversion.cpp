@@ -0,0 +1,100 @@
+#include "PixelConversion.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define CHAOS_PIXEL_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__) || defined(__AVX__)
+#define CHAOS_PIXEL_SSSE3
+#include <tmmintrin.h>
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+// The build does not target SSSE3, compile only its kernel for it and check the CPU at runtime
+#define CHAOS_PIXEL_SSSE3
+#define CHAOS_PIXEL_SSSE3_RUNTIME
+#include <tmmintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define CHAOS_PIXEL_NEON
+#include <arm_neon.h>
+#endif
+
+namespace ChaosEngine::PixelConversion {
+
+    void unormToFloat(const uint8_t *source, float *destination, size_t count) {
+        size_t i = 0;
+#if defined(CHAOS_PIXEL_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 max = _mm_set1_ps(255.0f);
+        for (; i + 16 <= count; i += 16) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            const __m128i lo16 = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i hi16 = _mm_unpackhi_epi8(bytes, zero);
+            // Divide instead of multiplying with the reciprocal to stay bit exact with the scalar path
+            _mm_storeu_ps(destination + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo16, zero)), max));
+            _mm_storeu_ps(destination + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo16, zero)), max));
+            _mm_storeu_ps(destination + i + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi16, zero)), max));
+            _mm_storeu_ps(destination + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi16, zero)), max));
+        }
+#elif defined(CHAOS_PIXEL_NEON)
+        const float32x4_t max = vdupq_n_f32(255.0f);
+        for (; i + 16 <= count; i += 16) {
+            const uint8x16_t bytes = vld1q_u8(source + i);
+            const uint16x8_t lo16 = vmovl_u8(vget_low_u8(bytes));
+            const uint16x8_t hi16 = vmovl_u8(vget_high_u8(bytes));
+            vst1q_f32(destination + i, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo16))), max));
+            vst1q_f32(destination + i + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo16))), max));
+            vst1q_f32(destination + i + 8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi16))), max));
+            vst1q_f32(destination + i + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi16))), max));
+        }
+#endif
+        for (; i < count; ++i) {
+            destination[i] = static_cast<float>(source[i]) / 255.0f;
+        }
+    }
+
+#if defined(CHAOS_PIXEL_SSSE3)
+#if defined(CHAOS_PIXEL_SSSE3_RUNTIME)
+    __attribute__((target("ssse3")))
+#endif
+    static size_t expandRGBToRGBASSSE3(const uint8_t *source, uint8_t *destination, size_t pixelCount) {
+        size_t i = 0;
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+        // Every load reads 16 bytes but only consumes 12, so stop early enough to stay inside the source
+        for (; i + 6 <= pixelCount; i += 4) {
+            const __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 3));
+            const __m128i rgba = _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i * 4), rgba);
+        }
+        return i;
+    }
+#endif
+
+    void expandRGBToRGBA(const uint8_t *source, uint8_t *destination, size_t pixelCount) {
+        size_t i = 0;
+#if defined(CHAOS_PIXEL_SSSE3_RUNTIME)
+        static const bool hasSSSE3 = __builtin_cpu_supports("ssse3");
+        if (hasSSSE3)
+            i = expandRGBToRGBASSSE3(source, destination, pixelCount);
+#elif defined(CHAOS_PIXEL_SSSE3)
+        i = expandRGBToRGBASSSE3(source, destination, pixelCount);
+#elif defined(CHAOS_PIXEL_NEON)
+        for (; i + 16 <= pixelCount; i += 16) {
+            const uint8x16x3_t rgb = vld3q_u8(source + i * 3);
+            uint8x16x4_t rgba;
+            rgba.val[0] = rgb.val[0];
+            rgba.val[1] = rgb.val[1];
+            rgba.val[2] = rgb.val[2];
+            rgba.val[3] = vdupq_n_u8(255);
+            vst4q_u8(destination + i * 4, rgba);
+        }
+#endif
+        for (; i < pixelCount; ++i) {
+            destination[i * 4] = source[i * 3];
+            destination[i * 4 + 1] = source[i * 3 + 1];
+            destination[i * 4 + 2] = source[i * 3 + 2];
+            destination[i * 4 + 3] = 255;
+        }
+    }
+
+}
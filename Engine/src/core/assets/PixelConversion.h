@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Conversion kernels used when decoding images, vectorized with SSE2 or NEON when the target supports it.
+ * On x86-64 the SSSE3 kernel is selected at runtime unless the build already targets SSSE3.
+ * Source and destination must not overlap.
+ */
+namespace ChaosEngine::PixelConversion {
+
+    /// Converts count 8 bit unorm values to floats in [0, 1].
+    void unormToFloat(const uint8_t *source, float *destination, size_t count);
+
+    /// Expands RGB8 pixels to RGBA8 with an opaque alpha channel.
+    void expandRGBToRGBA(const uint8_t *source, uint8_t *destination, size_t pixelCount);
+
+}
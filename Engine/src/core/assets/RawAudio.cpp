@@ -1,7 +1,7 @@
 #include "RawAudio.h"
 
-#include <filesystem>
-
+#include "Engine/src/core/assets/AssetLoader.h"
+#include "Engine/src/core/assets/CookedAssets.h"
 #include "Engine/src/core/utils/Logger.h"
 
 #define STB_VORBIS_HEADER_ONLY
@@ -19,9 +19,10 @@ static void show_info(stb_vorbis_info &info, const std::string &filename) {
 
 RawAudio RawAudio::loadOggFile(const std::string &filename) {
 
-    if (!std::filesystem::exists(filename)) {
+    if (!AssetLoader::exists(filename)) {
         throw std::runtime_error("[stb_vorbis] File does not exist " + filename);
     }
+    const auto fileContent = AssetLoader::loadBinary(filename);
 
 //    int vorbisErr = 0;
 //    std::unique_ptr<stb_vorbis, void (*)(stb_vorbis *ptr)>
@@ -38,7 +39,8 @@ RawAudio RawAudio::loadOggFile(const std::string &filename) {
 
     short *output = nullptr;
     int channels, sample_rate;
-    int samples = stb_vorbis_decode_filename(filename.c_str(), &channels, &sample_rate, &output);
+    int samples = stb_vorbis_decode_memory(reinterpret_cast<const unsigned char *>(fileContent.data()),
+                                           static_cast<int>(fileContent.size()), &channels, &sample_rate, &output);
     if (samples == -1) {
         throw std::runtime_error("[stb_vorbis] Failed to decode audio file " + filename);
     }
@@ -46,6 +48,49 @@ RawAudio RawAudio::loadOggFile(const std::string &filename) {
     return RawAudio{channels, sample_rate, samples, output};
 }
 
+RawAudio RawAudio::load(const std::string &filename) {
+    if (const auto cooked = CookedAssets::findCooked(CookedAssets::getAudioPath(filename)))
+        return readCooked(*cooked);
+    return loadOggFile(filename);
+}
+
+// Cooked audio is the decoded 16 bit PCM data, so loading it is a single copy
+static constexpr char cookedAudioMagic[5] = "CEAU";
+
+RawAudio RawAudio::readCooked(const std::string &filename) {
+    const auto fileContent = AssetLoader::loadBinary(filename);
+    CookedAssets::BinaryReader reader(fileContent, filename);
+    reader.readHeader(cookedAudioMagic);
+    const auto channels = reader.read<int32_t>();
+    const auto sampleRate = reader.read<int32_t>();
+    const auto samples = reader.read<int32_t>();
+    if (channels <= 0 || samples < 0)
+        throw std::runtime_error("[RawAudio] Invalid cooked audio file " + filename);
+
+    // Allocated with malloc, because the decoded data from stb_vorbis is released with free
+    const size_t size = sizeof(short) * static_cast<size_t>(samples) * static_cast<size_t>(channels);
+    auto *data = static_cast<short *>(malloc(size));
+    if (data == nullptr)
+        throw std::runtime_error("[RawAudio] Failed to allocate memory for " + filename);
+    try {
+        reader.readBytes(data, size);
+    } catch (...) {
+        free(data);
+        throw;
+    }
+    return RawAudio{channels, sampleRate, samples, data};
+}
+
+std::vector<char> RawAudio::writeCooked() const {
+    CookedAssets::BinaryWriter writer;
+    writer.writeHeader(cookedAudioMagic);
+    writer.write<int32_t>(channels);
+    writer.write<int32_t>(sampleRate);
+    writer.write<int32_t>(samples);
+    writer.writeBytes(data, getSize());
+    return std::move(writer.getData());
+}
+
 RawAudio::RawAudio(int channels, int sampleRate, int samples, short *data)
         : channels(channels), sampleRate(sampleRate), samples(samples), data(data),
           format(AudioFormat::MONO_8) {
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace ChaosEngine {
 
@@ -42,6 +43,13 @@ namespace ChaosEngine {
 
         static RawAudio loadOggFile(const std::string &filename);
 
+        /// Loads the decoded samples written by the asset cooker if available, otherwise decodes the Ogg file
+        static RawAudio load(const std::string &filename);
+
+        static RawAudio readCooked(const std::string &filename);
+
+        [[nodiscard]] std::vector<char> writeCooked() const;
+
         // Getter --------------------------------------------------------------------------
 
         [[nodiscard]] int getChannels() const { return channels; }
@@ -1,10 +1,19 @@
 #include "RawImage.h"
 
+#include "AssetLoader.h"
+#include "PixelConversion.h"
 #include "Engine/src/core/utils/Logger.h"
 
 #include <stb_image.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <future>
+#include <optional>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 
 namespace ChaosEngine {
@@ -32,42 +41,131 @@ namespace ChaosEngine {
     }
 
     RawImage RawImage::readImage(const std::string &filename, ImageFormat desiredFormat) {
-        int width, height, channels;
+        const auto decoded = decodeImage(filename, desiredFormat);
+        const uint64_t size = decoded.getSize();
+        auto finalPixels = std::make_unique<unsigned char[]>(size);
+        decoded.convertInto(finalPixels.get());
 
-        stbi_uc *pixels = stbi_load(filename.c_str(), &width, &height, &channels, getStbiFormat(desiredFormat));
+        return RawImage{std::move(finalPixels), decoded.getWidth(), decoded.getHeight(), size, desiredFormat};
+    }
 
-        if (!pixels) {
-            throw std::runtime_error("[STBI] Failed to load " + filename);
+    DecodedImage RawImage::decodeImage(const std::string &filename, ImageFormat desiredFormat) {
+        const auto fileContent = AssetLoader::loadBinary(filename);
+        const auto *data = reinterpret_cast<const stbi_uc *>(fileContent.data());
+        const auto dataSize = static_cast<int>(fileContent.size());
+        const int desiredChannels = getStbiFormat(desiredFormat); // STBI Format corresponds to the amount of channels
+
+        int width, height, channels;
+        if (!stbi_info_from_memory(data, dataSize, &width, &height, &channels)) {
+            throw std::runtime_error("[STBI] Failed to load " + filename + ": " + stbi_failure_reason());
         }
-        if (channels != getStbiFormat(desiredFormat)) {
+        if (channels != desiredChannels) {
             LOG_INFO(
                     "[RawImage] Desired Format and Image format are not the same! For image {} ; desired # channels {} != {} -> Converting",
-                    filename, getStbiFormat(desiredFormat), channels);
+                    filename, desiredChannels, channels);
         }
 
-        // Conversion of bytes to floats if necessary
-        std::unique_ptr<unsigned char[]> finalPixels = nullptr;
-        uint64_t size = 0;
-        if (desiredFormat == ImageFormat::Rf32 || desiredFormat == ImageFormat::Rf32Gf32Bf32Af32) {
-            size = width * height * sizeof(float) *
-                   getStbiFormat(desiredFormat); // STBI Format corresponds to the amount of channels
-            finalPixels = std::make_unique<unsigned char[]>(size);
-            auto *temp = reinterpret_cast<float *>(finalPixels.get());
-            for (int64_t i = 0; i < width * height * getStbiFormat(desiredFormat); ++i) {
-                temp[i] = static_cast<float>(pixels[i]) / 255.0f;
+        // RGB -> RGBA expansion is done by PixelConversion, everything else is converted by stb_image
+        const bool expandRGB = channels == 3 && desiredFormat == ImageFormat::R8G8B8A8;
+        const int loadChannels = expandRGB ? 3 : desiredChannels;
+        stbi_uc *pixels = stbi_load_from_memory(data, dataSize, &width, &height, &channels, loadChannels);
+        if (!pixels) {
+            throw std::runtime_error("[STBI] Failed to load " + filename + ": " + stbi_failure_reason());
+        }
+
+        return DecodedImage{pixels, static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+                            static_cast<uint32_t>(loadChannels), desiredFormat};
+    }
+
+    std::vector<DecodedImage>
+    RawImage::decodeImages(const std::vector<std::pair<std::string, ImageFormat>> &files) {
+        std::vector<std::optional<DecodedImage>> decoded(files.size());
+        std::atomic<size_t> next = 0;
+        const auto worker = [&]() {
+            for (size_t i = next++; i < files.size(); i = next++) {
+                decoded[i].emplace(decodeImage(files[i].first, files[i].second));
             }
-        } else if (desiredFormat == ImageFormat::R8 || desiredFormat == ImageFormat::R8G8B8A8) {
-            size = width * height * getStbiFormat(desiredFormat); // STBI Format corresponds to the amount of channels
-            finalPixels = std::make_unique<unsigned char[]>(size);
-            std::memcpy(finalPixels.get(), pixels, size);
-        } else {
-            assert("Unsupported Image Format!" && false);
+        };
+
+        const size_t workerCount = std::min<size_t>(files.size(), std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<std::future<void>> workers;
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers.emplace_back(std::async(std::launch::async, worker));
+        }
+        for (auto &w: workers) {
+            w.get(); // Rethrows decoding errors
         }
 
-        stbi_image_free(pixels);
+        std::vector<DecodedImage> images;
+        images.reserve(files.size());
+        for (auto &image: decoded) {
+            images.emplace_back(std::move(*image));
+        }
+        return images;
+    }
+
+// ------------------------------------ Decoded Image ------------------------------------------------------------------
+
+    DecodedImage::DecodedImage(unsigned char *pixels, uint32_t width, uint32_t height, uint32_t channels,
+                               ImageFormat format)
+            : pixels(pixels), width(width), height(height), channels(channels), format(format) {
+        assert("Pixels MUST not be NULL!" && DecodedImage::pixels != nullptr);
+    }
+
+    DecodedImage::~DecodedImage() {
+        if (pixels != nullptr)
+            stbi_image_free(pixels);
+    }
 
-        return RawImage{std::move(finalPixels), static_cast<uint32_t>(width), static_cast<uint32_t>(height), size,
-                        desiredFormat};
+    DecodedImage &DecodedImage::operator=(DecodedImage &&o) noexcept {
+        if (&o == this)
+            return *this;
+        if (pixels != nullptr)
+            stbi_image_free(pixels);
+        pixels = std::exchange(o.pixels, nullptr);
+        width = o.width;
+        height = o.height;
+        channels = o.channels;
+        format = o.format;
+        return *this;
+    }
+
+    uint64_t DecodedImage::getSize() const {
+        const uint64_t pixelCount = static_cast<uint64_t>(width) * height;
+        switch (format) {
+            case ImageFormat::R8:
+                return pixelCount;
+            case ImageFormat::R8G8B8A8:
+                return pixelCount * 4;
+            case ImageFormat::Rf32:
+                return pixelCount * sizeof(float);
+            case ImageFormat::Rf32Gf32Bf32Af32:
+                return pixelCount * 4 * sizeof(float);
+            default:
+                assert("Unsupported Image Format!" && false);
+                return 0;
+        }
+    }
+
+    void DecodedImage::convertInto(void *destination) const {
+        const uint64_t pixelCount = static_cast<uint64_t>(width) * height;
+        switch (format) {
+            case ImageFormat::R8:
+            case ImageFormat::R8G8B8A8:
+                if (channels == 3) {
+                    PixelConversion::expandRGBToRGBA(pixels, static_cast<uint8_t *>(destination), pixelCount);
+                } else {
+                    std::memcpy(destination, pixels, pixelCount * channels);
+                }
+                break;
+            case ImageFormat::Rf32:
+            case ImageFormat::Rf32Gf32Bf32Af32:
+                PixelConversion::unormToFloat(pixels, static_cast<float *>(destination), pixelCount * channels);
+                break;
+            default:
+                assert("Unsupported Image Format!" && false);
+        }
     }
 
     RawImage::RawImage(std::unique_ptr<unsigned char[]> pixels, uint32_t width, uint32_t height, uint64_t size,
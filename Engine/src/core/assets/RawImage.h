@@ -2,12 +2,57 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <utility>
 
 namespace ChaosEngine {
     // Note: 3 Component Image Formats are often not supported on Vulkan Hardware
     enum class ImageFormat {
         R8, R8G8B8A8,
         Rf32, Rf32Gf32Bf32Af32,
+        // Block compressed formats, can only be loaded from KTX2 files see CompressedImage
+        BC4_R, BC5_RG, BC7_RGBA,
+    };
+
+    /**
+     * Pixels as returned by the image decoder, not yet converted to the desired format.
+     * Allows the conversion to be written directly into its final destination e.g. a mapped staging buffer.
+     */
+    class DecodedImage {
+    public:
+        DecodedImage(unsigned char *pixels, uint32_t width, uint32_t height, uint32_t channels,
+                     ImageFormat format);
+
+        ~DecodedImage();
+
+        DecodedImage(const DecodedImage &o) = delete;
+
+        DecodedImage &operator=(const DecodedImage &o) = delete;
+
+        DecodedImage(DecodedImage &&o) noexcept
+                : pixels(std::exchange(o.pixels, nullptr)), width(o.width), height(o.height), channels(o.channels),
+                  format(o.format) {}
+
+        DecodedImage &operator=(DecodedImage &&o) noexcept;
+
+        /// Converts the decoded pixels into the desired format, destination MUST hold getSize() bytes
+        void convertInto(void *destination) const;
+
+        [[nodiscard]] uint32_t getWidth() const { return width; }
+
+        [[nodiscard]] uint32_t getHeight() const { return height; }
+
+        /// Size in bytes after the conversion to the desired format
+        [[nodiscard]] uint64_t getSize() const;
+
+        [[nodiscard]] ImageFormat getFormat() const { return format; }
+
+    private:
+        unsigned char *pixels; // Owned by stb_image
+        uint32_t width;
+        uint32_t height;
+        uint32_t channels; // Of the decoded pixels
+        ImageFormat format;
     };
 
     class RawImage {
@@ -39,6 +84,13 @@ namespace ChaosEngine {
 
         static RawImage readImage(const std::string &filename, ImageFormat desiredFormat);
 
+        /// Decodes an image without converting it, see DecodedImage::convertInto
+        static DecodedImage decodeImage(const std::string &filename, ImageFormat desiredFormat);
+
+        /// Decodes multiple images in parallel on worker threads, the results are in the order of the input
+        static std::vector<DecodedImage>
+        decodeImages(const std::vector<std::pair<std::string, ImageFormat>> &files);
+
 // ------------------------------------ Class Members ------------------------------------------------------------------
 
         [[nodiscard]] unsigned char *getPixels() const { return pixels.get(); }
@@ -0,0 +1,91 @@
+#include "TextureStreamer.h"
+
+#include "Engine/src/core/utils/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace ChaosEngine {
+
+    void TextureStreamer::track(Renderer::Texture *texture) {
+        if (texture == nullptr || !texture->getSource())
+            return;
+        entries.emplace_back(Entry{texture});
+    }
+
+    uint64_t TextureStreamer::getResidentSize() const {
+        uint64_t size = 0;
+        for (const auto &entry: entries) {
+            size += entry.texture->getMemorySize();
+        }
+        return size;
+    }
+
+    void TextureStreamer::update(Renderer::GraphicsContext &context) {
+        const uint64_t frame = context.getFrameCounter();
+
+        std::vector<Entry *> finished;
+        for (auto &entry: entries) {
+            if (!entry.texture->isEvicted())
+                continue;
+            if (entry.pendingLoad.valid()) {
+                if (entry.pendingLoad.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    finished.emplace_back(&entry);
+            } else if (!entry.loadFailed && entry.texture->getLastUsedFrame() > entry.evictedFrame) {
+                // Referenced again since it got evicted
+                entry.pendingLoad = std::async(std::launch::async, &Renderer::Texture::LoadSource,
+                                               *entry.texture->getSource());
+            }
+        }
+
+        std::vector<Entry *> candidates;
+        if (getResidentSize() > settings.budget) {
+            for (auto &entry: entries) {
+                if (!entry.pendingLoad.valid() && entry.texture->canEvict(settings.residentExtent) &&
+                    entry.texture->getLastUsedFrame() + settings.minUnusedFrames <= frame)
+                    candidates.emplace_back(&entry);
+            }
+        }
+
+        if (finished.empty() && candidates.empty())
+            return;
+        // Replacing an image invalidates the descriptors pointing to it, none of them may be in use
+        context.waitIdle();
+        restoreFinishedLoads(finished);
+        evictLeastRecentlyUsed(frame, candidates);
+    }
+
+    void TextureStreamer::restoreFinishedLoads(std::vector<Entry *> &finished) {
+        for (auto *entry: finished) {
+            try {
+                entry->texture->restore(entry->pendingLoad.get());
+            } catch (const std::exception &e) {
+                // Keep the low resolution image instead of retrying every frame
+                LOG_ERROR("[TextureStreamer] Failed to stream in {}: {}", entry->texture->getSource()->filename,
+                          e.what());
+                entry->loadFailed = true;
+            }
+        }
+    }
+
+    void TextureStreamer::evictLeastRecentlyUsed(uint64_t frame, std::vector<Entry *> &candidates) {
+        std::sort(candidates.begin(), candidates.end(), [](const Entry *a, const Entry *b) {
+            return a->texture->getLastUsedFrame() < b->texture->getLastUsedFrame();
+        });
+
+        uint64_t residentSize = getResidentSize();
+        uint32_t evictedCount = 0;
+        for (auto *entry: candidates) {
+            if (residentSize <= settings.budget)
+                break;
+            const uint64_t previousSize = entry->texture->getMemorySize();
+            entry->texture->evict(settings.residentExtent);
+            entry->evictedFrame = frame;
+            residentSize = residentSize - previousSize + entry->texture->getMemorySize();
+            ++evictedCount;
+        }
+        LOG_DEBUG("[TextureStreamer] Evicted {} textures, {} of {} bytes resident", evictedCount, residentSize,
+                  settings.budget);
+    }
+
+}
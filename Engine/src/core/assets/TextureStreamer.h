@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Engine/src/renderer/api/Texture.h"
+#include "Engine/src/renderer/api/GraphicsContext.h"
+
+#include <vector>
+#include <future>
+#include <cstdint>
+
+namespace ChaosEngine {
+
+    /**
+     * Keeps the GPU memory of streamable textures within a budget.
+     * Textures which have not been used for a while are evicted least recently used first down to a low resolution mip
+     * level, when an evicted texture is referenced again its source is reloaded on a worker thread and uploaded once
+     * the load finished. Until then the low resolution levels are shown.
+     */
+    class TextureStreamer {
+    public:
+        struct Settings {
+            /// GPU memory all tracked textures may occupy in bytes
+            uint64_t budget = 256ull * 1024 * 1024;
+            /// Largest extent of the mip level kept resident for evicted textures
+            uint32_t residentExtent = 64;
+            /// Textures used within this many frames are never evicted
+            uint32_t minUnusedFrames = 120;
+        };
+
+    public:
+        TextureStreamer() = default;
+
+        explicit TextureStreamer(const Settings &settings) : settings(settings) {}
+
+        ~TextureStreamer() = default;
+
+        TextureStreamer(const TextureStreamer &o) = delete;
+
+        TextureStreamer &operator=(const TextureStreamer &o) = delete;
+
+        /// Tracks a texture, textures without a source can not be reloaded and are ignored
+        void track(Renderer::Texture *texture);
+
+        /**
+         * Uploads finished loads, requests loads for referenced evicted textures and evicts textures while the budget
+         * is exceeded. Waits for the GPU to be idle if any image gets replaced, should be called before a frame is
+         * recorded.
+         */
+        void update(Renderer::GraphicsContext &context);
+
+        /// GPU memory currently occupied by all tracked textures
+        [[nodiscard]] uint64_t getResidentSize() const;
+
+        [[nodiscard]] const Settings &getSettings() const { return settings; }
+
+        void setBudget(uint64_t budget) { settings.budget = budget; }
+
+    private:
+        struct Entry {
+            Renderer::Texture *texture;
+            uint64_t evictedFrame = 0;
+            std::future<Renderer::Texture::SourceImage> pendingLoad{};
+            bool loadFailed = false;
+        };
+
+    private:
+        void restoreFinishedLoads(std::vector<Entry *> &finished);
+
+        void evictLeastRecentlyUsed(uint64_t frame, std::vector<Entry *> &candidates);
+
+    private:
+        Settings settings{};
+        std::vector<Entry> entries{};
+    };
+
+}
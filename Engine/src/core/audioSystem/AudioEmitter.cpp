@@ -0,0 +1,225 @@
+#include "AudioEmitter.h"
+
+#include <cmath>
+#include <cassert>
+
+#define AL_LIBTYPE_STATIC
+
+#include <AL/al.h>
+
+#include "OpenALHelpers.h"
+
+using namespace ChaosEngine;
+using namespace OpenALHelpers;
+
+// ------------------------------------ Voice --------------------------------------------------------------------------
+
+void AudioEmitter::assignVoice(uint32_t voice) {
+    handle = voice;
+    alSourcef(handle, AL_PITCH, pitch);
+    checkALErrors("alSourcef(AL_PITCH)", handle);
+    alSourcef(handle, AL_GAIN, gain);
+    checkALErrors("alSourcef(AL_GAIN)", handle);
+    alSource3f(handle, AL_POSITION, position.x, position.y, position.z);
+    checkALErrors("alSource3f(AL_POSITION)", handle);
+    alSource3f(handle, AL_VELOCITY, velocity.x, velocity.y, velocity.z);
+    checkALErrors("alSource3f(AL_VELOCITY)", handle);
+
+    if (stream) {
+        // The queue itself must not loop, the stream continues decoding from the start instead
+        alSourcei(handle, AL_LOOPING, AL_FALSE);
+        checkALErrors("alSourcei(AL_LOOPING)", handle);
+        stream->seek(handle, static_cast<uint32_t>(playbackOffset * static_cast<float>(stream->getSampleRate())));
+        if (state == State::Playing)
+            stream->start(handle);
+    } else if (buffer) {
+        alSourcei(handle, AL_LOOPING, looping ? AL_TRUE : AL_FALSE);
+        checkALErrors("alSourcei(AL_LOOPING)", handle);
+        alSourcei(handle, AL_BUFFER, (int) buffer->handle);
+        checkALErrors("alSourcei(AL_BUFFER)", handle);
+        alSourcef(handle, AL_SEC_OFFSET, playbackOffset);
+        checkALErrors("alSourcef(AL_SEC_OFFSET)", handle);
+    }
+
+    // A paused emitter stays in the initial state and starts at the offset once it is resumed
+    if (state == State::Playing) {
+        alSourcePlay(handle);
+        checkALErrors("alSourcePlay", handle);
+    }
+}
+
+void AudioEmitter::virtualize() {
+    if (handle == 0)
+        return;
+    playbackOffset = (state == State::Stopped) ? 0 : getPlaybackOffset();
+
+    alSourceStop(handle);
+    checkALErrors("alSourceStop", handle);
+    // Unqueues all buffers of the stopped source
+    if (stream)
+        stream->seek(handle, static_cast<uint32_t>(playbackOffset * static_cast<float>(stream->getSampleRate())));
+    alSourcei(handle, AL_BUFFER, 0);
+    checkALErrors("alSourcei(AL_BUFFER)", handle);
+    handle = 0;
+}
+
+void AudioEmitter::updateVoice() {
+    if (handle == 0)
+        return;
+    if (stream) {
+        stream->update(handle);
+        if (state == State::Playing && !stream->isPlaying()) {
+            state = State::Stopped;
+            playbackOffset = 0;
+        }
+        return;
+    }
+
+    if (state != State::Playing)
+        return;
+    ALint sourceState = AL_STOPPED;
+    alGetSourcei(handle, AL_SOURCE_STATE, &sourceState);
+    checkALErrors("alGetSourcei(AL_SOURCE_STATE)", handle);
+    if (sourceState == AL_STOPPED) {
+        state = State::Stopped;
+        playbackOffset = 0;
+    }
+}
+
+void AudioEmitter::advanceVirtual(float deltaTime) {
+    if (handle != 0 || state != State::Playing)
+        return;
+    const float duration = getDuration();
+    playbackOffset += deltaTime * pitch;
+    if (playbackOffset < duration)
+        return;
+    if (looping && duration > 0) {
+        playbackOffset = std::fmod(playbackOffset, duration);
+    } else {
+        state = State::Stopped;
+        playbackOffset = 0;
+    }
+}
+
+float AudioEmitter::getPlaybackOffset() const {
+    if (handle == 0)
+        return playbackOffset;
+    if (stream)
+        return static_cast<float>(stream->getPosition(handle)) / static_cast<float>(stream->getSampleRate());
+    ALfloat offset = 0;
+    alGetSourcef(handle, AL_SEC_OFFSET, &offset);
+    checkALErrors("alGetSourcef(AL_SEC_OFFSET)", handle);
+    return offset;
+}
+
+float AudioEmitter::getDuration() const {
+    if (stream)
+        return static_cast<float>(stream->getLength()) / static_cast<float>(stream->getSampleRate());
+    if (buffer)
+        return static_cast<float>(buffer->getSamples()) / static_cast<float>(buffer->getSampleRate());
+    return 0;
+}
+
+void AudioEmitter::publish() {
+    publishedState.store(state, std::memory_order_relaxed);
+    publishedOffset.store(getPlaybackOffset(), std::memory_order_relaxed);
+    publishedVirtual.store(handle == 0, std::memory_order_relaxed);
+}
+
+// ------------------------------------ Commands -----------------------------------------------------------------------
+
+void AudioEmitter::setBuffer(std::shared_ptr<AudioBuffer> nbuffer) {
+    assert("The voice must be released before changing the buffer" && handle == 0);
+    stream = nullptr;
+    buffer = std::move(nbuffer);
+    state = State::Stopped;
+    playbackOffset = 0;
+}
+
+void AudioEmitter::setStream(std::shared_ptr<AudioStream> nstream) {
+    assert("The voice must be released before changing the stream" && handle == 0);
+    buffer = nullptr;
+    stream = std::move(nstream);
+    stream->setLooping(looping);
+    state = State::Stopped;
+    playbackOffset = 0;
+}
+
+void AudioEmitter::play() {
+    if (handle != 0) {
+        if (state != State::Paused) {
+            // Restart from the beginning
+            alSourceStop(handle);
+            checkALErrors("alSourceStop", handle);
+            if (stream)
+                stream->seek(handle, 0);
+        }
+        if (stream)
+            stream->start(handle);
+        alSourcePlay(handle);
+        checkALErrors("alSourcePlay", handle);
+    }
+    if (state != State::Paused)
+        playbackOffset = 0;
+    state = State::Playing;
+}
+
+void AudioEmitter::pause() {
+    if (state != State::Playing)
+        return;
+    state = State::Paused;
+    if (handle != 0) {
+        alSourcePause(handle);
+        checkALErrors("alSourcePause", handle);
+    }
+}
+
+void AudioEmitter::stop() {
+    state = State::Stopped;
+    playbackOffset = 0;
+    if (handle == 0)
+        return;
+    alSourceStop(handle);
+    checkALErrors("alSourceStop", handle);
+    if (stream)
+        stream->seek(handle, 0);
+}
+
+void AudioEmitter::setPositionAndVelocity(const glm::vec3 &nposition, const glm::vec3 &nvelocity) {
+    position = nposition;
+    velocity = nvelocity;
+    if (handle == 0)
+        return;
+    alSource3f(handle, AL_POSITION, position.x, position.y, position.z);
+    checkALErrors("alSource3f(AL_POSITION)", handle);
+    alSource3f(handle, AL_VELOCITY, velocity.x, velocity.y, velocity.z);
+    checkALErrors("alSource3f(AL_VELOCITY)", handle);
+}
+
+void AudioEmitter::setPitch(float npitch) {
+    pitch = npitch;
+    if (handle == 0)
+        return;
+    alSourcef(handle, AL_PITCH, pitch);
+    checkALErrors("alSourcef(AL_PITCH)", handle);
+}
+
+void AudioEmitter::setGain(float ngain) {
+    gain = ngain;
+    if (handle == 0)
+        return;
+    alSourcef(handle, AL_GAIN, gain);
+    checkALErrors("alSourcef(AL_GAIN)", handle);
+}
+
+void AudioEmitter::setLooping(bool loop) {
+    looping = loop;
+    if (stream) {
+        stream->setLooping(looping);
+        return;
+    }
+    if (handle == 0)
+        return;
+    alSourcei(handle, AL_LOOPING, (looping) ? AL_TRUE : AL_FALSE);
+    checkALErrors("alSourcei(AL_LOOPING)", handle);
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <memory>
+#include <atomic>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+#include "Engine/src/core/audioSystem/api/AudioSource.h"
+
+namespace ChaosEngine {
+
+    /**
+     * Audio thread side of an AudioSource, holds the parameters and playback state and drives the voice while it has
+     * one. Everything except the published state MUST only be accessed from the audio thread.
+     */
+    class AudioEmitter {
+    public:
+        using State = AudioSource::State;
+
+    public:
+        AudioEmitter(const glm::vec3 &position, bool looping) : position(position), looping(looping) {}
+
+        ~AudioEmitter() = default;
+
+        AudioEmitter(const AudioEmitter &o) = delete;
+
+        AudioEmitter &operator=(const AudioEmitter &o) = delete;
+
+        // ---- Commands, the voice MUST be released before the buffer or stream changes ----
+
+        void setBuffer(std::shared_ptr<AudioBuffer> buffer);
+
+        void setStream(std::shared_ptr<AudioStream> stream);
+
+        void play();
+
+        void pause();
+
+        void stop();
+
+        void setPitch(float pitch);
+
+        void setGain(float gain);
+
+        void setLooping(bool looping);
+
+        void setPriority(int nPriority) { priority = nPriority; }
+
+        void setRange(float nRange) { range = nRange; }
+
+        void setPositionAndVelocity(const glm::vec3 &position, const glm::vec3 &velocity);
+
+        // ---- Voice management ----
+
+        /// Applies all parameters to the voice and continues at the tracked playback position
+        void assignVoice(uint32_t voice);
+
+        /// Stores the playback position and detaches the buffer or the queued buffers of a stream from the voice
+        void virtualize();
+
+        /// Keeps the buffer queue of a stream filled and notices when the voice stopped playing
+        void updateVoice();
+
+        /// Advances the playback position while the emitter is virtual
+        void advanceVirtual(float deltaTime);
+
+        [[nodiscard]] uint32_t getVoice() const { return handle; }
+
+        [[nodiscard]] State getState() const { return state; }
+
+        [[nodiscard]] int getPriority() const { return priority; }
+
+        [[nodiscard]] float getRange() const { return range; }
+
+        [[nodiscard]] float getGain() const { return gain; }
+
+        [[nodiscard]] const glm::vec3 &getPosition() const { return position; }
+
+        // ---- Published state, readable from the main thread ----
+
+        /// Makes the current state visible to the main thread
+        void publish();
+
+        [[nodiscard]] State getPublishedState() const { return publishedState.load(std::memory_order_relaxed); }
+
+        /// Playback position in seconds
+        [[nodiscard]] float getPublishedOffset() const { return publishedOffset.load(std::memory_order_relaxed); }
+
+        [[nodiscard]] bool isPublishedVirtual() const { return publishedVirtual.load(std::memory_order_relaxed); }
+
+    private:
+        /// Playback position in seconds
+        [[nodiscard]] float getPlaybackOffset() const;
+
+        /// Length of the buffer or stream in seconds
+        [[nodiscard]] float getDuration() const;
+
+    private:
+        uint32_t handle = 0; // Voice, 0 while virtual
+        std::shared_ptr<AudioBuffer> buffer = nullptr;
+        std::shared_ptr<AudioStream> stream = nullptr;
+        glm::vec3 position;
+        glm::vec3 velocity{0, 0, 0};
+        float pitch = 1;
+        float gain = 1;
+        bool looping = false;
+        int priority = 0;
+        float range = std::numeric_limits<float>::infinity();
+        State state = State::Stopped;
+        float playbackOffset = 0; // Seconds, only up to date while virtual
+
+        std::atomic<State> publishedState = State::Stopped;
+        std::atomic<float> publishedOffset = 0;
+        std::atomic<bool> publishedVirtual = true;
+    };
+
+}
@@ -9,8 +9,9 @@
 using namespace ChaosEngine;
 using namespace OpenALHelpers;
 
-AudioSystem::AudioSystem() {
-    const int audioDevice = -1;
+std::unique_ptr<AudioThread> AudioSystem::Thread = nullptr;
+
+AudioSystem::AudioSystem(WorkerPool &workers) : workers(workers) {
     availableAudioDevices.clear();
 
     ALboolean enumeration1 = alcIsExtensionPresent(NULL, "ALC_ENUMERATION_EXT");
@@ -34,8 +35,14 @@ AudioSystem::AudioSystem() {
             Logger::E("OpenAL", "Error while enumerating devices");
         }
     }
+}
 
-    if (availableAudioDevices.empty() || audioDevice < 0 || availableAudioDevices.size() >= audioDevice) {
+void AudioSystem::openDevice(AudioBackend nbackend) {
+    const int audioDevice = -1;
+    backend = nbackend;
+    if (backend == AudioBackend::Loopback) {
+        openLoopbackDevice();
+    } else if (availableAudioDevices.empty() || audioDevice < 0 || availableAudioDevices.size() >= audioDevice) {
         Logger::I("OpenAL", "Using default audio device");
         openALDevice = alcOpenDevice(nullptr);
     } else if (audioDevice >= 0) {
@@ -53,31 +60,96 @@ AudioSystem::AudioSystem() {
     checkALCErrors(openALDevice, "alcIsExtensionPresent(ALC_EXT_EFX)");
     if (isEffectsEnginePresent == AL_FALSE)
         Logger::W("OpenAL", "Effects engine is not present");
+}
 
+void AudioSystem::openLoopbackDevice() {
+    if (!alcIsExtensionPresent(nullptr, "ALC_SOFT_loopback")) {
+        Logger::C("OpenAL", "ALC_SOFT_loopback is not supported -> AudioSystem will remain offline");
+        return;
+    }
+    auto alcLoopbackOpenDevice = reinterpret_cast<LPALCLOOPBACKOPENDEVICESOFT>(
+            alcGetProcAddress(nullptr, "alcLoopbackOpenDeviceSOFT"));
+    auto alcIsRenderFormatSupported = reinterpret_cast<LPALCISRENDERFORMATSUPPORTEDSOFT>(
+            alcGetProcAddress(nullptr, "alcIsRenderFormatSupportedSOFT"));
+    alcRenderSamples = reinterpret_cast<LPALCRENDERSAMPLESSOFT>(alcGetProcAddress(nullptr, "alcRenderSamplesSOFT"));
+
+    Logger::I("OpenAL", "Using loopback device");
+    openALDevice = alcLoopbackOpenDevice(nullptr);
+    if (openALDevice == nullptr)
+        return;
+    if (!alcIsRenderFormatSupported(openALDevice, loopbackSampleRate, ALC_STEREO_SOFT, ALC_FLOAT_SOFT)) {
+        Logger::C("OpenAL", "Loopback device does not support stereo float output");
+        alcCloseDevice(openALDevice);
+        openALDevice = nullptr;
+    }
+}
+
+void AudioSystem::renderLoopback(float deltaTime) {
+    // The fractional frame is carried over so the rendered length matches the engine clock exactly
+    const double frames = static_cast<double>(deltaTime) * loopbackSampleRate + loopbackFrameRemainder;
+    const auto frameCount = static_cast<size_t>(frames);
+    loopbackFrameRemainder = frames - static_cast<double>(frameCount);
+    if (frameCount == 0)
+        return;
+
+    const size_t offset = loopbackOutput.size();
+    loopbackOutput.resize(offset + frameCount * loopbackChannels);
+    alcRenderSamples(openALDevice, loopbackOutput.data() + offset, static_cast<ALCsizei>(frameCount));
+    if (!captureLoopback)
+        loopbackOutput.clear();
+}
+
+std::vector<float> AudioSystem::takeLoopbackOutput() {
+    std::vector<float> output;
+    output.swap(loopbackOutput);
+    return output;
 }
 
 AudioSystem::~AudioSystem() {
+    // Applies the remaining commands and deletes the voices before the context
+    Thread = nullptr;
+    closeDevice();
+}
+
+void AudioSystem::closeDevice() {
     if (openALDevice != nullptr && openALContext != nullptr) {
+        alcMakeContextCurrent(nullptr);
         alcDestroyContext(openALContext);
         checkALCErrors(openALDevice, "Context destruction");
     }
     if (openALDevice != nullptr)
         alcCloseDevice(openALDevice);
+    openALContext = nullptr;
+    openALDevice = nullptr;
 }
 
-void AudioSystem::init(Scene &/*scene*/) {
+void AudioSystem::init(Scene &/*scene*/, AudioBackend nbackend) {
+    Thread = nullptr;
+    if (openALDevice == nullptr || backend != nbackend) {
+        closeDevice();
+        openDevice(nbackend);
+    }
     if (openALDevice == nullptr)
         return;
     if (openALContext != nullptr) {
         alcDestroyContext(openALContext);
         checkALCErrors(openALDevice, "Context destruction");
+        openALContext = nullptr;
     }
 
-    ALint openALAttribs[4] = {0};
-    openALAttribs[0] = ALC_MAX_AUXILIARY_SENDS; // request 4 auxiliary channels for effects
-    openALAttribs[1] = 4;
+    std::vector<ALint> openALAttribs = {
+            ALC_MAX_AUXILIARY_SENDS, 4, // request 4 auxiliary channels for effects
+    };
+    if (backend == AudioBackend::Loopback) {
+        openALAttribs.insert(openALAttribs.end(), {
+                ALC_FORMAT_CHANNELS_SOFT, ALC_STEREO_SOFT,
+                ALC_FORMAT_TYPE_SOFT, ALC_FLOAT_SOFT,
+                ALC_FREQUENCY, static_cast<ALint>(loopbackSampleRate),
+        });
+    }
+    openALAttribs.emplace_back(0);
 
-    openALContext = alcCreateContext(openALDevice, openALAttribs);
+    openALContext = alcCreateContext(openALDevice, openALAttribs.data());
     checkALCErrors(openALDevice, "alcCreateContext");
     if (openALContext == nullptr) {
         Logger::C("OpenAL", "Failed to initialize OpenAL Context -> AudioSystem will remain offline");
@@ -103,39 +175,74 @@ void AudioSystem::init(Scene &/*scene*/) {
     ALfloat orientation[] = {0, 0, -1, 0, 1, 0};
     alListenerfv(AL_ORIENTATION, orientation);
     checkALErrors("alListenerfv(AL_ORIENTATION)");
+
+    listenerValid = false;
+    listenerPosition = glm::vec3{0, 0, 0};
+
+    // The loopback device is mixed on the main thread in lockstep with the engine clock
+    Thread = std::make_unique<AudioThread>(VoiceManager::Settings{}, backend == AudioBackend::Device);
+    Logger::D("OpenAL", "Created " + std::to_string(Thread->getVoiceCount()) + " voices");
 }
 
-void AudioSystem::update(ECS &ecs, float /*deltaTime*/) {
+void AudioSystem::update(ECS &ecs, float deltaTime) {
+    if (Thread == nullptr)
+        return;
     auto listeners = ecs.getRegistry().view<const Transform, const AudioListenerComponent>();
-    auto sources = ecs.getRegistry().view<const Transform, AudioSourceComponent>();
 
     entt::entity mainListener = entt::null;
     for (const auto &[entity, transform, listener]: listeners.each()) {
         if (mainListener == entt::null && listener.active) {
             mainListener = entity;
-            const auto &pos = transform.position;
-            alListener3f(AL_POSITION, pos.x, pos.y, pos.z);
-            checkALErrors("alListener3f(AL_POSITION)");
-
-            const auto &rotation = transform.rotation;
-            auto rot = glm::quat({glm::radians(rotation.x), glm::radians(rotation.y), glm::radians(rotation.z)});
-            glm::vec3 up = glm::toMat3(rot) * glm::vec3{0, 1, 0};
-            glm::vec3 forward = glm::toMat3(rot) * glm::vec3{0, 0, -1};
-            ALfloat orientation[] = {forward.x, forward.y, forward.z, up.x, up.y, up.z};
-            alListenerfv(AL_ORIENTATION, orientation);
-            checkALErrors("alListenerfv(AL_ORIENTATION)");
+            updateListener(transform);
         } else if (listener.active) {
             LOG_WARN("Only one listener can be active at a time!");
         }
     }
 
+    // Velocities are computed on the workers, commands MUST be submitted from the main thread
+    auto sources = ecs.parallelView<const Transform, AudioSourceComponent>(workers);
+    sourceVelocities.resize(sources.size());
+    sourceMoved.resize(sources.size());
+    sources.chunks([&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto [transform, source] = sources.get(i);
+            sourceVelocities[i] = transform.position - source.oldPosition;
+            source.oldPosition = transform.position;
+            sourceMoved[i] = transform.position != source.source.position ||
+                             sourceVelocities[i] != source.source.velocity;
+        }
+    });
+    // Only sources which moved since the last update submit a command
+    for (size_t i = 0; i < sources.size(); ++i) {
+        if (!sourceMoved[i])
+            continue;
+        auto [transform, source] = sources.get(i);
+        source.source.setPositionAndVelocity(transform.position, sourceVelocities[i]);
+    }
+
+    if (backend == AudioBackend::Loopback) {
+        Thread->update(deltaTime);
+        renderLoopback(deltaTime);
+    }
+}
+
+void AudioSystem::updateListener(const Transform &transform) {
+    const auto &pos = transform.position;
+    if (!listenerValid || pos != listenerPosition) {
+        Thread->submit(AudioCommand{.type = AudioCommand::Type::SetListenerPosition, .first = pos});
+        listenerPosition = pos;
+    }
 
-    for (const auto &[entity, transform, source]: sources.each()) {
-        const auto &pos = transform.position;
-        glm::vec3 velocity = transform.position - source.oldPosition;
-        source.oldPosition = pos;
-        source.source.setPositionAndVelocity(pos, velocity);
+    const auto &rotation = transform.rotation;
+    if (!listenerValid || rotation != listenerRotation) {
+        auto rot = glm::quat({glm::radians(rotation.x), glm::radians(rotation.y), glm::radians(rotation.z)});
+        glm::vec3 up = glm::toMat3(rot) * glm::vec3{0, 1, 0};
+        glm::vec3 forward = glm::toMat3(rot) * glm::vec3{0, 0, -1};
+        Thread->submit(AudioCommand{.type = AudioCommand::Type::SetListenerOrientation,
+                                    .first = forward, .second = up});
+        listenerRotation = rotation;
     }
+    listenerValid = true;
 }
 
 Transform AudioSystem::GetListenerPosition() {
@@ -3,33 +3,82 @@
 #include "Engine/src/core/Scene.h"
 
 #include "Engine/src/core/assets/RawAudio.h"
+#include "AudioThread.h"
 
 #define AL_LIBTYPE_STATIC
 #include <AL/al.h>
 #include <AL/alc.h>
+#include <AL/alext.h>
 
 
 namespace ChaosEngine {
 
     class AudioSystem {
     public:
-        AudioSystem();
+        static constexpr uint32_t loopbackSampleRate = 48000;
+        static constexpr uint32_t loopbackChannels = 2;
+
+    public:
+        explicit AudioSystem(WorkerPool &workers);
 
         ~AudioSystem();
 
-        void init(Scene &scene);
+        /// Opens the device of the backend if it changed and creates a new context
+        void init(Scene &scene, AudioBackend backend = AudioBackend::Device);
 
+        /// With the loopback backend this also mixes deltaTime seconds of audio
         void update(ECS &ecs, float deltaTime);
 
+        [[nodiscard]] AudioBackend getBackend() const { return backend; }
+
+        /// Keeps the output of the loopback backend until it is taken, disabled by default
+        void setLoopbackCapture(bool capture) { captureLoopback = capture; }
+
+        /// Interleaved stereo samples at loopbackSampleRate mixed since the last call
+        std::vector<float> takeLoopbackOutput();
+
         // Debug Information
 
         static Transform GetListenerPosition();
 
+        /// nullptr while the AudioSystem is offline
+        static AudioThread *GetAudioThread() { return Thread.get(); }
+
+    private:
+        void openDevice(AudioBackend backend);
+
+        void openLoopbackDevice();
+
+        void closeDevice();
+
+        void renderLoopback(float deltaTime);
+
+        void updateListener(const Transform &transform);
+
     private:
+        static std::unique_ptr<AudioThread> Thread;
+
+        WorkerPool &workers;
         std::vector<std::string> availableAudioDevices;
         ALCdevice* openALDevice = nullptr;
         // to be moved
         ALCcontext *openALContext = nullptr;
+        AudioBackend backend = AudioBackend::Device;
+
+        // Loopback backend
+        LPALCRENDERSAMPLESSOFT alcRenderSamples = nullptr;
+        std::vector<float> loopbackOutput;
+        double loopbackFrameRemainder = 0;
+        bool captureLoopback = false;
+
+        // Last listener state submitted to the audio thread
+        bool listenerValid = false;
+        glm::vec3 listenerPosition{0, 0, 0};
+        glm::vec3 listenerRotation{0, 0, 0};
+
+        // Per source results of the parallel update, reused every update
+        std::vector<glm::vec3> sourceVelocities;
+        std::vector<uint8_t> sourceMoved;
     };
 
 }
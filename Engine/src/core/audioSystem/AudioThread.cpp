@@ -0,0 +1,166 @@
+#include "AudioThread.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include <AL/alc.h>
+
+#include "Engine/src/core/utils/Logger.h"
+#include "OpenALHelpers.h"
+
+using namespace ChaosEngine;
+using namespace OpenALHelpers;
+
+AudioThread::AudioThread(const VoiceManager::Settings &settings, bool threaded)
+        : commands(queueCapacity), voices(VoiceManager::Create(settings)), voiceCount(voices->getVoiceCount()) {
+    if (alIsExtensionPresent("AL_SOFT_deferred_updates")) {
+        alDeferUpdates = reinterpret_cast<LPALDEFERUPDATESSOFT>(alGetProcAddress("alDeferUpdatesSOFT"));
+        alProcessUpdates = reinterpret_cast<LPALPROCESSUPDATESSOFT>(alGetProcAddress("alProcessUpdatesSOFT"));
+    }
+    if (threaded)
+        thread = std::thread(&AudioThread::run, this);
+}
+
+AudioThread::~AudioThread() {
+    if (thread.joinable()) {
+        stopRequested.store(true, std::memory_order_release);
+        thread.join();
+    } else {
+        update(0);
+    }
+
+    if (!emitters.empty())
+        LOG_ERROR("[AudioThread] {} AudioSources outlived the AudioSystem", emitters.size());
+    // Detaches all buffers from the voices before streams and buffers are released
+    voices = nullptr;
+    emitters.clear();
+}
+
+void AudioThread::submit(AudioCommand &&command) {
+    if (commands.tryPush(std::move(command)))
+        return;
+    if (thread.joinable()) {
+        LOG_WARN("[AudioThread] Command queue is full, waiting for the audio thread");
+    } else {
+        // The caller is the consumer as well
+        update(0);
+    }
+    while (!commands.tryPush(std::move(command)))
+        std::this_thread::yield();
+}
+
+// ------------------------------------ Audio Thread -------------------------------------------------------------------
+
+void AudioThread::run() {
+    auto lastUpdate = std::chrono::steady_clock::now();
+    while (true) {
+        // Commands submitted before the stop request are still applied in this iteration
+        const bool stopping = stopRequested.load(std::memory_order_acquire);
+
+        const auto now = std::chrono::steady_clock::now();
+        update(std::chrono::duration<float>(now - lastUpdate).count());
+        lastUpdate = now;
+
+        if (stopping)
+            return;
+        std::this_thread::sleep_for(updateInterval);
+    }
+}
+
+void AudioThread::update(float deltaTime) {
+    beginBatch();
+    AudioCommand command;
+    while (commands.tryPop(command)) {
+        execute(command);
+    }
+    voices->update(emitters, listenerPosition, deltaTime);
+    endBatch();
+
+    for (auto &emitter: emitters) {
+        emitter->publish();
+    }
+    activeVoiceCount.store(voices->getActiveVoiceCount(), std::memory_order_relaxed);
+}
+
+void AudioThread::execute(AudioCommand &command) {
+    AudioEmitter *emitter = command.emitter;
+    switch (command.type) {
+        case AudioCommand::Type::None:
+            break;
+        case AudioCommand::Type::AddEmitter:
+            emitters.emplace_back(emitter);
+            break;
+        case AudioCommand::Type::RemoveEmitter: {
+            voices->release(*emitter);
+            const auto it = std::find_if(emitters.begin(), emitters.end(),
+                                         [&](const auto &e) { return e.get() == emitter; });
+            assert("Removed emitter was never added" && it != emitters.end());
+            std::swap(*it, emitters.back());
+            emitters.pop_back();
+            break;
+        }
+        case AudioCommand::Type::SetBuffer:
+            voices->release(*emitter);
+            emitter->setBuffer(std::move(command.buffer));
+            break;
+        case AudioCommand::Type::SetStream:
+            voices->release(*emitter);
+            emitter->setStream(std::move(command.stream));
+            break;
+        case AudioCommand::Type::Play:
+            emitter->play();
+            break;
+        case AudioCommand::Type::Pause:
+            emitter->pause();
+            break;
+        case AudioCommand::Type::Stop:
+            emitter->stop();
+            break;
+        case AudioCommand::Type::SetPitch:
+            emitter->setPitch(command.value);
+            break;
+        case AudioCommand::Type::SetGain:
+            emitter->setGain(command.value);
+            break;
+        case AudioCommand::Type::SetLooping:
+            emitter->setLooping(command.intValue != 0);
+            break;
+        case AudioCommand::Type::SetPriority:
+            emitter->setPriority(command.intValue);
+            break;
+        case AudioCommand::Type::SetRange:
+            emitter->setRange(command.value);
+            break;
+        case AudioCommand::Type::SetPositionAndVelocity:
+            emitter->setPositionAndVelocity(command.first, command.second);
+            break;
+        case AudioCommand::Type::SetListenerPosition:
+            listenerPosition = command.first;
+            alListener3f(AL_POSITION, listenerPosition.x, listenerPosition.y, listenerPosition.z);
+            checkALErrors("alListener3f(AL_POSITION)");
+            break;
+        case AudioCommand::Type::SetListenerOrientation: {
+            ALfloat orientation[] = {command.first.x, command.first.y, command.first.z,
+                                     command.second.x, command.second.y, command.second.z};
+            alListenerfv(AL_ORIENTATION, orientation);
+            checkALErrors("alListenerfv(AL_ORIENTATION)");
+            break;
+        }
+    }
+}
+
+void AudioThread::beginBatch() {
+    if (alDeferUpdates != nullptr) {
+        alDeferUpdates();
+    } else {
+        alcSuspendContext(alcGetCurrentContext());
+    }
+}
+
+void AudioThread::endBatch() {
+    if (alProcessUpdates != nullptr) {
+        alProcessUpdates();
+    } else {
+        alcProcessContext(alcGetCurrentContext());
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+#include <glm/glm.hpp>
+
+#define AL_LIBTYPE_STATIC
+
+#include <AL/al.h>
+#include <AL/alext.h>
+
+#include "Engine/src/core/utils/SPSCQueue.h"
+#include "AudioEmitter.h"
+#include "VoiceManager.h"
+
+namespace ChaosEngine {
+
+    struct AudioCommand {
+        enum class Type : uint8_t {
+            None,
+            AddEmitter, RemoveEmitter,
+            SetBuffer, SetStream,
+            Play, Pause, Stop,
+            SetPitch, SetGain, SetLooping, SetPriority, SetRange,
+            SetPositionAndVelocity,
+            SetListenerPosition, SetListenerOrientation,
+        };
+
+        Type type = Type::None;
+        AudioEmitter *emitter = nullptr; // Owned by the audio thread once AddEmitter was submitted
+        glm::vec3 first{0, 0, 0}; // Position or forward direction
+        glm::vec3 second{0, 0, 0}; // Velocity or up direction
+        float value = 0;
+        int32_t intValue = 0;
+        std::shared_ptr<AudioBuffer> buffer = nullptr;
+        std::shared_ptr<AudioStream> stream = nullptr;
+    };
+
+    /**
+     * Owns all OpenAL sources and performs all playback related OpenAL calls.
+     * The main thread submits commands into a lock-free queue, the audio thread applies them, manages the voices and
+     * keeps streams fed at a fixed interval independent of the frame rate. Playback state is published back to the
+     * AudioEmitters after every update.
+     * Without a thread of its own the owner calls update instead, e.g. to mix deterministically with a loopback device.
+     */
+    class AudioThread {
+    public:
+        static constexpr size_t queueCapacity = 4096;
+        static constexpr std::chrono::milliseconds updateInterval{5};
+
+    public:
+        /// The OpenAL context MUST be current
+        explicit AudioThread(const VoiceManager::Settings &settings, bool threaded = true);
+
+        /// Applies all submitted commands before the thread exits
+        ~AudioThread();
+
+        AudioThread(const AudioThread &o) = delete;
+
+        AudioThread &operator=(const AudioThread &o) = delete;
+
+        /// MUST only be called from the main thread, waits if the audio thread fell behind by a full queue
+        void submit(AudioCommand &&command);
+
+        /// Applies all submitted commands and updates the voices, MUST only be called if the AudioThread is not threaded
+        void update(float deltaTime);
+
+        [[nodiscard]] uint32_t getVoiceCount() const { return voiceCount; }
+
+        [[nodiscard]] uint32_t getActiveVoiceCount() const { return activeVoiceCount.load(std::memory_order_relaxed); }
+
+    private:
+        void run();
+
+        void execute(AudioCommand &command);
+
+        /// Defers all parameter changes of an update so the mixer applies them at once
+        void beginBatch();
+
+        void endBatch();
+
+    private:
+        SPSCQueue<AudioCommand> commands;
+        std::unique_ptr<VoiceManager> voices;
+        uint32_t voiceCount;
+        // Only accessed by the audio thread
+        std::vector<std::unique_ptr<AudioEmitter>> emitters;
+        glm::vec3 listenerPosition{0, 0, 0};
+        // AL_SOFT_deferred_updates, alcSuspendContext is a no-op on most implementations
+        LPALDEFERUPDATESSOFT alDeferUpdates = nullptr;
+        LPALPROCESSUPDATESSOFT alProcessUpdates = nullptr;
+
+        std::atomic<uint32_t> activeVoiceCount = 0;
+        std::atomic<bool> stopRequested = false;
+        std::thread thread; // Not joinable if the owner drives the updates
+    };
+
+}
@@ -0,0 +1,120 @@
+#include "VoiceManager.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "Engine/src/core/utils/Logger.h"
+#include "AudioEmitter.h"
+#include "OpenALHelpers.h"
+
+using namespace ChaosEngine;
+using namespace OpenALHelpers;
+
+// OpenAL defaults of AL_REFERENCE_DISTANCE and AL_ROLLOFF_FACTOR, emitters do not change them
+static constexpr float referenceDistance = 1.0f;
+static constexpr float rolloffFactor = 1.0f;
+
+std::unique_ptr<VoiceManager> VoiceManager::Create(const Settings &settings) {
+    std::vector<uint32_t> handles;
+    handles.reserve(settings.maxVoices);
+    for (uint32_t i = 0; i < settings.maxVoices; ++i) {
+        ALuint source = 0;
+        alGenSources(1, &source);
+        // Running out of sources is expected on devices with a hard limit
+        if (alGetError() != AL_NO_ERROR || source == 0)
+            break;
+        handles.emplace_back(source);
+    }
+    if (handles.size() < settings.maxVoices)
+        LOG_WARN("[VoiceManager] Only {} of {} voices available", handles.size(), settings.maxVoices);
+    return std::unique_ptr<VoiceManager>(new VoiceManager(std::move(handles), settings));
+}
+
+VoiceManager::VoiceManager(std::vector<uint32_t> &&handles, const Settings &settings) : settings(settings) {
+    voices.reserve(handles.size());
+    for (uint32_t handle: handles) {
+        freeVoices.emplace_back(static_cast<uint32_t>(voices.size()));
+        voices.emplace_back(Voice{handle});
+    }
+}
+
+VoiceManager::~VoiceManager() {
+    for (auto &voice: voices) {
+        if (voice.owner != nullptr)
+            voice.owner->virtualize();
+        alDeleteSources(1, &voice.handle);
+        checkALErrors("alDeleteSources", voice.handle);
+    }
+}
+
+// ------------------------------------ Assignment ---------------------------------------------------------------------
+
+void VoiceManager::update(std::vector<std::unique_ptr<AudioEmitter>> &emitters, const glm::vec3 &listenerPosition,
+                          float deltaTime) {
+    candidates.clear();
+    for (auto &emitter: emitters) {
+        emitter->updateVoice();
+        if (emitter->getState() == AudioEmitter::State::Stopped) {
+            release(*emitter);
+            continue;
+        }
+
+        float audibility = getAudibility(*emitter, listenerPosition);
+        const bool audible = audibility >= settings.minAudibility;
+        if (emitter->getVoice() != 0)
+            audibility *= settings.hysteresis;
+        candidates.emplace_back(Candidate{emitter.get(), audibility, audible});
+    }
+
+    // Only the emitters which get a voice need to be ordered
+    const size_t realCount = std::min(candidates.size(), voices.size());
+    std::nth_element(candidates.begin(), candidates.begin() + static_cast<ptrdiff_t>(realCount), candidates.end(),
+                     [](const Candidate &a, const Candidate &b) {
+                         if (a.audible != b.audible)
+                             return a.audible;
+                         if (a.emitter->getPriority() != b.emitter->getPriority())
+                             return a.emitter->getPriority() > b.emitter->getPriority();
+                         return a.audibility > b.audibility;
+                     });
+
+    // Free the voices of outranked emitters first so they can be reassigned in the same update
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (i >= realCount || !candidates[i].audible)
+            release(*candidates[i].emitter);
+    }
+    for (size_t i = 0; i < realCount; ++i) {
+        if (candidates[i].audible && candidates[i].emitter->getVoice() == 0)
+            assign(*candidates[i].emitter);
+    }
+
+    for (auto &candidate: candidates) {
+        candidate.emitter->advanceVirtual(deltaTime);
+    }
+}
+
+void VoiceManager::assign(AudioEmitter &emitter) {
+    assert("No voice left to assign" && !freeVoices.empty());
+    auto &voice = voices[freeVoices.back()];
+    freeVoices.pop_back();
+    voice.owner = &emitter;
+    emitter.assignVoice(voice.handle);
+}
+
+void VoiceManager::release(AudioEmitter &emitter) {
+    if (emitter.getVoice() == 0)
+        return;
+    const auto it = std::find_if(voices.begin(), voices.end(),
+                                 [&](const Voice &voice) { return voice.handle == emitter.getVoice(); });
+    assert("Emitter owns a voice which is not part of the pool" && it != voices.end());
+    emitter.virtualize();
+    it->owner = nullptr;
+    freeVoices.emplace_back(static_cast<uint32_t>(it - voices.begin()));
+}
+
+float VoiceManager::getAudibility(const AudioEmitter &emitter, const glm::vec3 &listenerPosition) {
+    const float distance = std::max(glm::distance(emitter.getPosition(), listenerPosition), referenceDistance);
+    if (distance > emitter.getRange())
+        return 0;
+    return emitter.getGain() * referenceDistance /
+           (referenceDistance + rolloffFactor * (distance - referenceDistance));
+}
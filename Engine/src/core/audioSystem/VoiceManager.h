@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace ChaosEngine {
+
+    class AudioEmitter;
+
+    /**
+     * Fixed pool of OpenAL sources (voices) shared by all AudioEmitters, only used by the audio thread.
+     * Every update the playing emitters are ranked by priority and by how loud they are at the listener, the highest
+     * ranked emitters get a voice and all others are virtualized. Virtual emitters are not mixed but keep track of their
+     * playback position, so they continue seamlessly once they get a voice again.
+     */
+    class VoiceManager {
+    public:
+        struct Settings {
+            /// Upper bound of OpenAL sources to create, the device may support fewer
+            uint32_t maxVoices = 32;
+            /// Emitters quieter than this at the listener are virtualized even if voices are free
+            float minAudibility = 0.001f;
+            /// Bonus for emitters which already own a voice to keep similarly loud emitters from swapping every update
+            float hysteresis = 1.1f;
+        };
+
+    private:
+        VoiceManager(std::vector<uint32_t> &&handles, const Settings &settings);
+
+    public:
+        ~VoiceManager();
+
+        VoiceManager(const VoiceManager &o) = delete;
+
+        VoiceManager &operator=(const VoiceManager &o) = delete;
+
+        VoiceManager(VoiceManager &&o) = delete;
+
+        VoiceManager &operator=(VoiceManager &&o) = delete;
+
+        /// Creates up to settings.maxVoices voices, the OpenAL context MUST be current
+        static std::unique_ptr<VoiceManager> Create(const Settings &settings);
+
+        /// Reassigns the voices according to the current ranking and advances the virtual sources
+        void update(std::vector<std::unique_ptr<AudioEmitter>> &emitters, const glm::vec3 &listenerPosition,
+                    float deltaTime);
+
+        /// Virtualizes the emitter and returns its voice to the pool
+        void release(AudioEmitter &emitter);
+
+        [[nodiscard]] uint32_t getVoiceCount() const { return static_cast<uint32_t>(voices.size()); }
+
+        [[nodiscard]] uint32_t getActiveVoiceCount() const {
+            return static_cast<uint32_t>(voices.size() - freeVoices.size());
+        }
+
+        [[nodiscard]] const Settings &getSettings() const { return settings; }
+
+    private:
+        struct Voice {
+            uint32_t handle;
+            AudioEmitter *owner = nullptr;
+        };
+
+        struct Candidate {
+            AudioEmitter *emitter;
+            float audibility;
+            bool audible;
+        };
+
+    private:
+        /// Gain at the listener with OpenALs default inverse distance clamped model
+        [[nodiscard]] static float getAudibility(const AudioEmitter &emitter, const glm::vec3 &listenerPosition);
+
+        void assign(AudioEmitter &emitter);
+
+    private:
+        Settings settings;
+        std::vector<Voice> voices;
+        std::vector<uint32_t> freeVoices; // Indices into voices
+        std::vector<Candidate> candidates; // Kept to reuse its memory
+    };
+
+}
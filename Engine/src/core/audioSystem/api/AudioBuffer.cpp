@@ -16,7 +16,7 @@ using namespace OpenALHelpers;
 std::shared_ptr<AudioBuffer> AudioBuffer::Create(const std::string &filename) {
     ALuint buffer;
 
-    auto audio = RawAudio::loadOggFile(filename);
+    auto audio = RawAudio::load(filename);
     ALenum format = getALFormat(audio.getFormat());
 
     alGenBuffers(1, &buffer);
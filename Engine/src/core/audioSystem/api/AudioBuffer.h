@@ -56,7 +56,7 @@ namespace ChaosEngine {
         void destroy();
 
     private:
-        friend class AudioSource;
+        friend class AudioEmitter;
 
         uint32_t handle;
         AudioFormat format;
@@ -1,102 +1,120 @@
 #include "AudioSource.h"
 
-#include <stdexcept>
+#include "Engine/src/core/audioSystem/AudioSystem.h"
+#include "Engine/src/core/audioSystem/AudioThread.h"
+#include "Engine/src/core/scriptSystem/NativeScript.h"
 
-#define AL_LIBTYPE_STATIC
-
-#include <AL/al.h>
-
-#include "Engine/src/core/audioSystem/OpenALHelpers.h"
+#include <cassert>
 
 using namespace ChaosEngine;
-using namespace OpenALHelpers;
+
+using Type = AudioCommand::Type;
 
 AudioSource AudioSource::Create(const glm::vec3 &position, bool looping) {
-    ALuint source;
-    alGenSources(1, &source);
-    checkALErrors("alGenSources", source);
-    if (source == 0)
-        throw std::runtime_error("[AudioSource] Failed to create new OpenAL source");
-
-    alSourcef(source, AL_PITCH, 1);
-    checkALErrors("alSourcef(AL_PITCH)", source);
-    alSourcef(source, AL_GAIN, 1);
-    checkALErrors("alSourcef(AL_GAIN)", source);
-    alSource3f(source, AL_POSITION, position.x, position.y, position.z);
-    checkALErrors("alSource3f(AL_POSITION)", source);
-    alSource3f(source, AL_VELOCITY, 0, 0, 0);
-    checkALErrors("alSource3f(AL_VELOCITY)", source);
-    alSourcei(source, AL_LOOPING, (looping) ? AL_TRUE : AL_FALSE);
-    checkALErrors("alSourcei(AL_LOOPING)", source);
-
-    return AudioSource{source};
+    auto *thread = AudioSystem::GetAudioThread();
+    if (thread == nullptr)
+        return AudioSource{nullptr, position, looping};
+
+    assert("AudioSources must only be controlled on the main thread" && !NativeScript::isRunningInParallel());
+    // The audio thread takes ownership of the emitter
+    auto *emitter = new AudioEmitter(position, looping);
+    thread->submit(AudioCommand{.type = Type::AddEmitter, .emitter = emitter});
+    return AudioSource{emitter, position, looping};
 }
 
 void AudioSource::destroy() {
-    if (handle == 0)
+    if (emitter == nullptr)
         return;
+    // The emitter detaches the stream buffers from its voice before the stream is released
+    submit(AudioCommand{.type = Type::RemoveEmitter});
+    emitter = nullptr;
+}
 
-    alDeleteSources(1, &handle);
-    checkALErrors("alDeleteSources", handle);
+void AudioSource::submit(AudioCommand &&command) const {
+    // The command queue of the audio thread has a single producer
+    assert("AudioSources must only be controlled on the main thread" && !NativeScript::isRunningInParallel());
+    auto *thread = AudioSystem::GetAudioThread();
+    if (emitter == nullptr || thread == nullptr)
+        return;
+    command.emitter = emitter;
+    thread->submit(std::move(command));
 }
 
 void AudioSource::setBuffer(std::shared_ptr<AudioBuffer> nbuffer) {
+    stream = nullptr;
     buffer = std::move(nbuffer);
+    submit(AudioCommand{.type = Type::SetBuffer, .buffer = buffer});
+}
 
-    alSourcei(handle, AL_BUFFER, (int) buffer->handle);
-    checkALErrors("alSourcei(AL_BUFFER)", handle);
+void AudioSource::setStream(std::unique_ptr<AudioStream> nstream) {
+    buffer = nullptr;
+    stream = std::move(nstream);
+    submit(AudioCommand{.type = Type::SetStream, .stream = stream});
 }
 
 void AudioSource::play() {
-    alSourcePlay(handle);
-    checkALErrors("alSourcePlay", handle);
+    submit(AudioCommand{.type = Type::Play});
 }
 
 void AudioSource::pause() {
-    alSourcePause(handle);
-    checkALErrors("alSourcePause", handle);
+    submit(AudioCommand{.type = Type::Pause});
 }
 
 void AudioSource::stop() {
-    alSourceStop(handle);
-    checkALErrors("alSourceStop", handle);
+    submit(AudioCommand{.type = Type::Stop});
 }
 
-void AudioSource::setPosition(const glm::vec3 &position) {
-    alSource3f(handle, AL_POSITION, position.x, position.y, position.z);
-    checkALErrors("alSource3f(AL_POSITION)", handle);
+void AudioSource::setPositionAndVelocity(const glm::vec3 &nposition, const glm::vec3 &nvelocity) {
+    if (nposition == position && nvelocity == velocity)
+        return;
+    position = nposition;
+    velocity = nvelocity;
+    submit(AudioCommand{.type = Type::SetPositionAndVelocity, .first = position, .second = velocity});
 }
 
-void AudioSource::setVelocity(const glm::vec3 &velocity) {
-    alSource3f(handle, AL_VELOCITY, velocity.x, velocity.y, velocity.z);
-    checkALErrors("alSource3f(AL_VELOCITY)", handle);
+void AudioSource::setPitch(float pitch) {
+    submit(AudioCommand{.type = Type::SetPitch, .value = pitch});
 }
 
-void AudioSource::setPositionAndVelocity(const glm::vec3 &position, const glm::vec3 &velocity) {
-    alSource3f(handle, AL_POSITION, position.x, position.y, position.z);
-    checkALErrors("alSource3f(AL_POSITION)", handle);
-    alSource3f(handle, AL_VELOCITY, velocity.x, velocity.y, velocity.z);
-    checkALErrors("alSource3f(AL_VELOCITY)", handle);
+void AudioSource::setGain(float gain) {
+    submit(AudioCommand{.type = Type::SetGain, .value = gain});
+}
 
+void AudioSource::setLooping(bool loop) {
+    looping = loop;
+    submit(AudioCommand{.type = Type::SetLooping, .intValue = looping ? 1 : 0});
 }
 
-void AudioSource::setPitch(float pitch) {
-    alSourcef(handle, AL_PITCH, pitch);
-    checkALErrors("alSourcef(AL_PITCH)", handle);
+void AudioSource::setPriority(int npriority) {
+    priority = npriority;
+    submit(AudioCommand{.type = Type::SetPriority, .intValue = priority});
 }
 
-void AudioSource::setGain(float gain) {
-    alSourcef(handle, AL_GAIN, gain);
-    checkALErrors("alSourcef(AL_GAIN)", handle);
+void AudioSource::setRange(float nrange) {
+    range = nrange;
+    submit(AudioCommand{.type = Type::SetRange, .value = range});
+}
+
+// ------------------------------------ Published State ----------------------------------------------------------------
+
+AudioSource::State AudioSource::getState() const {
+    return (emitter != nullptr) ? emitter->getPublishedState() : State::Stopped;
+}
+
+bool AudioSource::isVirtual() const {
+    return (emitter == nullptr) || emitter->isPublishedVirtual();
 }
 
-void AudioSource::setLooping(bool looping) {
-    alSourcei(handle, AL_LOOPING, (looping) ? AL_TRUE : AL_FALSE);
-    checkALErrors("alSourcei(AL_LOOPING)", handle);
+uint32_t AudioSource::getStreamPosition() const {
+    if (!stream || emitter == nullptr)
+        return 0;
+    return static_cast<uint32_t>(emitter->getPublishedOffset() * static_cast<float>(stream->getSampleRate()));
 }
 
 size_t AudioSource::getBufferPosition() const {
-    ALint res = 0;
-    alGetSourcei(handle, AL_BYTE_OFFSET, &res);
-    return res;
+    if (!buffer || emitter == nullptr)
+        return 0;
+    const auto sample = static_cast<size_t>(emitter->getPublishedOffset() *
+                                            static_cast<float>(buffer->getSampleRate()));
+    return sample * buffer->getChannels() * buffer->getSampleSize();
 }
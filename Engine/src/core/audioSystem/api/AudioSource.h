@@ -2,17 +2,38 @@
 
 #include <string>
 #include <memory>
+#include <limits>
 
 #include <glm/glm.hpp>
 
 #include "AudioBuffer.h"
+#include "AudioStream.h"
 
 namespace ChaosEngine {
 
+    class AudioEmitter;
+
+    struct AudioCommand;
+
+    /**
+     * Sound emitter in the scene.
+     * Every call is forwarded as a command to the audio thread and never blocks on the driver. The VoiceManager on the
+     * audio thread assigns the source one of its OpenAL sources (a voice) while it belongs to the most audible sources.
+     * Without a voice the source is virtual, its playback position keeps advancing and it continues from there once it
+     * gets a voice again.
+     * @note MUST only be used from the main thread, the queried playback state lags behind by up to one audio update
+     */
     class AudioSource {
     public:
-        explicit AudioSource(uint32_t handle) : handle(handle) {}
+        enum class State {
+            Stopped, Playing, Paused
+        };
 
+    private:
+        AudioSource(AudioEmitter *emitter, const glm::vec3 &position, bool looping)
+                : emitter(emitter), position(position), looping(looping) {}
+
+    public:
         ~AudioSource() { destroy(); }
 
         AudioSource(const AudioSource &o) = delete;
@@ -20,15 +41,24 @@ namespace ChaosEngine {
         AudioSource &operator=(const AudioSource &o) = delete;
 
         AudioSource(AudioSource &&o) noexcept
-                : handle(o.handle), buffer(std::move(o.buffer)) { o.handle = 0; }
+                : emitter(o.emitter), buffer(std::move(o.buffer)), stream(std::move(o.stream)), position(o.position),
+                  velocity(o.velocity), looping(o.looping), priority(o.priority), range(o.range) {
+            o.emitter = nullptr;
+        }
 
         AudioSource &operator=(AudioSource &&o) noexcept {
             if (&o == this)
                 return *this;
             destroy();
-            handle = o.handle;
-            o.handle = 0;
+            emitter = o.emitter;
+            o.emitter = nullptr;
             buffer = std::move(o.buffer);
+            stream = std::move(o.stream);
+            position = o.position;
+            velocity = o.velocity;
+            looping = o.looping;
+            priority = o.priority;
+            range = o.range;
             return *this;
         }
 
@@ -40,6 +70,10 @@ namespace ChaosEngine {
 
         void setBuffer(std::shared_ptr<AudioBuffer> buffer);
 
+        /// Plays the stream instead of a buffer, the source takes ownership of the stream
+        void setStream(std::unique_ptr<AudioStream> stream);
+
+        /// Starts playing from the beginning or resumes a paused source
         void play();
 
         void pause();
@@ -52,25 +86,53 @@ namespace ChaosEngine {
 
         void setLooping(bool looping);
 
+        /// Sources with a higher priority get a voice before any source with a lower priority
+        void setPriority(int priority);
+
+        /// Beyond this distance to the listener the source is inaudible and never gets a voice
+        void setRange(float range);
+
+        [[nodiscard]] State getState() const;
+
+        [[nodiscard]] int getPriority() const { return priority; }
+
+        [[nodiscard]] float getRange() const { return range; }
+
+        /// True while the source has no voice and is not mixed
+        [[nodiscard]] bool isVirtual() const;
+
         size_t getBufferPosition() const;
 
         const AudioBuffer &getBuffer() const { return *buffer; }
 
+        [[nodiscard]] bool isStreaming() const { return stream != nullptr; }
+
+        const AudioStream &getStream() const { return *stream; }
+
+        /// Playback position of the stream in samples per channel
+        [[nodiscard]] uint32_t getStreamPosition() const;
+
     private:
         void destroy();
 
     private:
         friend class AudioSystem;
 
-        void setPosition(const glm::vec3 &position);
-
-        void setVelocity(const glm::vec3 &velocity);
-
+        /// Only submits a command if the values changed
         void setPositionAndVelocity(const glm::vec3 &position, const glm::vec3 &velocity);
 
+        /// Does nothing while the AudioSystem is offline
+        void submit(AudioCommand &&command) const;
+
     private:
-        uint32_t handle;
+        AudioEmitter *emitter; // Owned by the audio thread, nullptr while the AudioSystem is offline
         std::shared_ptr<AudioBuffer> buffer = nullptr;
+        std::shared_ptr<AudioStream> stream = nullptr; // Shared with the emitter which drives it
+        glm::vec3 position;
+        glm::vec3 velocity{0, 0, 0};
+        bool looping = false;
+        int priority = 0;
+        float range = std::numeric_limits<float>::infinity();
     };
 
 }
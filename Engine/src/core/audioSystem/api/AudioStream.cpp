@@ -0,0 +1,233 @@
+#include "AudioStream.h"
+
+#include <stdexcept>
+#include <algorithm>
+
+#define AL_LIBTYPE_STATIC
+
+#include <AL/al.h>
+
+#include "Engine/src/core/audioSystem/OpenALHelpers.h"
+#include "Engine/src/core/assets/AssetLoader.h"
+#include "Engine/src/core/utils/Logger.h"
+
+#define STB_VORBIS_HEADER_ONLY
+
+#include "stb_vorbis.c"
+
+using namespace ChaosEngine;
+using namespace OpenALHelpers;
+
+std::unique_ptr<AudioStream> AudioStream::Open(const std::string &filename) {
+    if (!AssetLoader::exists(filename)) {
+        throw std::runtime_error("[AudioStream] File does not exist " + filename);
+    }
+    auto encoded = AssetLoader::loadBinary(filename);
+
+    int vorbisError = 0;
+    stb_vorbis *decoder = stb_vorbis_open_memory(reinterpret_cast<const unsigned char *>(encoded.data()),
+                                                 static_cast<int>(encoded.size()), &vorbisError, nullptr);
+    if (decoder == nullptr) {
+        throw std::runtime_error("[AudioStream] Failed to open audio file " + filename + " (stb_vorbis error " +
+                                 std::to_string(vorbisError) + ")");
+    }
+    return std::unique_ptr<AudioStream>(new AudioStream(std::move(encoded), decoder));
+}
+
+AudioStream::AudioStream(std::vector<char> &&pEncoded, stb_vorbis *decoder)
+        : encoded(std::move(pEncoded)), decoder(decoder), channels(0), sampleRate(0), format(AudioFormat::MONO_16),
+          length(stb_vorbis_stream_length_in_samples(decoder)) {
+    const stb_vorbis_info info = stb_vorbis_get_info(decoder);
+    channels = std::min(info.channels, 2); // OpenAL only supports mono and stereo buffers
+    sampleRate = static_cast<int>(info.sample_rate);
+    format = (channels == 1) ? AudioFormat::MONO_16 : AudioFormat::STEREO_16;
+
+    alGenBuffers(bufferCount, buffers.data());
+    checkALErrors("alGenBuffers");
+    freeBuffers.assign(buffers.begin(), buffers.end());
+
+    decoderThread = std::thread(&AudioStream::decode, this);
+}
+
+AudioStream::~AudioStream() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopDecoder = true;
+    }
+    decoderWakeUp.notify_one();
+    decoderThread.join();
+
+    // The owning source has already detached all buffers
+    alDeleteBuffers(bufferCount, buffers.data());
+    checkALErrors("alDeleteBuffers");
+    stb_vorbis_close(decoder);
+}
+
+// ------------------------------------ Decoder Thread -----------------------------------------------------------------
+
+void AudioStream::decode() {
+    const auto chunkSamples = static_cast<size_t>(static_cast<float>(sampleRate) * bufferSeconds);
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        decoderWakeUp.wait(lock, [this]() {
+            return stopDecoder || seekRequested ||
+                   ((!endOfStream || looping) && decodedChunks.size() < bufferCount);
+        });
+        if (stopDecoder)
+            return;
+        if (seekRequested) {
+            if (seekTarget == 0) {
+                stb_vorbis_seek_start(decoder);
+            } else {
+                stb_vorbis_seek(decoder, seekTarget);
+            }
+            decodedChunks.clear();
+            endOfStream = false;
+            seekRequested = false;
+            continue;
+        }
+
+        // The decoder is only touched by this thread, so the lock is not needed while decoding
+        lock.unlock();
+        std::vector<short> chunk(chunkSamples * channels);
+        size_t decoded = 0;
+        bool reachedEnd = false;
+        bool restarted = false;
+        while (decoded < chunkSamples) {
+            const int samples = stb_vorbis_get_samples_short_interleaved(
+                    decoder, channels, chunk.data() + decoded * channels,
+                    static_cast<int>((chunkSamples - decoded) * channels));
+            if (samples > 0) {
+                decoded += samples;
+                restarted = false;
+            } else if (looping && !restarted) {
+                // Continue seamlessly with the beginning of the file
+                stb_vorbis_seek_start(decoder);
+                restarted = true;
+            } else {
+                reachedEnd = true;
+                break;
+            }
+        }
+        chunk.resize(decoded * channels);
+        lock.lock();
+
+        if (seekRequested)
+            continue; // Chunk belongs to the previous playback
+        if (!chunk.empty())
+            decodedChunks.emplace_back(std::move(chunk));
+        endOfStream = reachedEnd;
+    }
+}
+
+// ------------------------------------ Playback -----------------------------------------------------------------------
+
+void AudioStream::queueDecodedChunks(uint32_t source) {
+    while (!freeBuffers.empty()) {
+        std::vector<short> chunk;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (decodedChunks.empty())
+                break;
+            chunk = std::move(decodedChunks.front());
+            decodedChunks.pop_front();
+        }
+        decoderWakeUp.notify_one();
+
+        const uint32_t buffer = freeBuffers.back();
+        freeBuffers.pop_back();
+        const auto index = std::find(buffers.begin(), buffers.end(), buffer) - buffers.begin();
+        bufferSamples[index] = static_cast<uint32_t>(chunk.size() / channels);
+        alBufferData(buffer, getALFormat(format), chunk.data(), static_cast<ALsizei>(chunk.size() * sizeof(short)),
+                     sampleRate);
+        checkALErrors("alBufferData", buffer);
+        alSourceQueueBuffers(source, 1, &buffer);
+        checkALErrors("alSourceQueueBuffers", source);
+        queuedBuffers.push_back(buffer);
+    }
+}
+
+void AudioStream::update(uint32_t source) {
+    ALint processed = 0;
+    alGetSourcei(source, AL_BUFFERS_PROCESSED, &processed);
+    checkALErrors("alGetSourcei(AL_BUFFERS_PROCESSED)", source);
+    for (ALint i = 0; i < processed; ++i) {
+        ALuint buffer = 0;
+        alSourceUnqueueBuffers(source, 1, &buffer);
+        checkALErrors("alSourceUnqueueBuffers", source);
+        // Buffers are processed in queue order
+        queuedBuffers.pop_front();
+        processedSamples += bufferSamples[std::find(buffers.begin(), buffers.end(), buffer) - buffers.begin()];
+        freeBuffers.emplace_back(buffer);
+    }
+
+    if (!playing)
+        return;
+    queueDecodedChunks(source);
+
+    ALint state = AL_STOPPED;
+    alGetSourcei(source, AL_SOURCE_STATE, &state);
+    checkALErrors("alGetSourcei(AL_SOURCE_STATE)", source);
+    if (state == AL_PLAYING || state == AL_PAUSED)
+        return;
+    if (!queuedBuffers.empty()) {
+        // The decoder could not keep up and the source ran out of buffers
+        LOG_DEBUG("[AudioStream] Buffer underrun, restarting source {}", source);
+        alSourcePlay(source);
+        checkALErrors("alSourcePlay", source);
+    } else {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (endOfStream && decodedChunks.empty())
+            playing = false;
+    }
+}
+
+void AudioStream::start(uint32_t source) {
+    if (!playing && queuedBuffers.empty()) {
+        // Playing again after the stream has ended
+        std::lock_guard<std::mutex> lock(mutex);
+        if (endOfStream && decodedChunks.empty()) {
+            requestSeek(0);
+            processedSamples = 0;
+        }
+    }
+    decoderWakeUp.notify_one();
+    playing = true;
+    queueDecodedChunks(source);
+}
+
+void AudioStream::setLooping(bool loop) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        looping = loop;
+    }
+    decoderWakeUp.notify_one();
+}
+
+void AudioStream::seek(uint32_t source, uint32_t sample) {
+    playing = false;
+    // A stopped source has processed all its buffers
+    update(source);
+    processedSamples = (length > 0) ? sample % length : sample;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requestSeek(processedSamples);
+    }
+    decoderWakeUp.notify_one();
+}
+
+void AudioStream::requestSeek(uint32_t sample) {
+    // Chunks decoded up to now belong to the previous playback
+    decodedChunks.clear();
+    endOfStream = false;
+    seekRequested = true;
+    seekTarget = sample;
+}
+
+uint32_t AudioStream::getPosition(uint32_t source) const {
+    ALint offset = 0;
+    alGetSourcei(source, AL_SAMPLE_OFFSET, &offset);
+    checkALErrors("alGetSourcei(AL_SAMPLE_OFFSET)", source);
+    const uint32_t position = processedSamples + static_cast<uint32_t>(offset);
+    return (length > 0) ? position % length : position;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <array>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+#include "core/assets/RawAudio.h"
+
+typedef struct stb_vorbis stb_vorbis;
+
+namespace ChaosEngine {
+
+    /**
+     * Ogg Vorbis file which is decoded incrementally while it is played, for music and ambience.
+     * A decoder thread keeps a few chunks of PCM data ahead, which are uploaded into a small ring of OpenAL buffers
+     * queued on the playing source. Memory usage is independent of the length of the file.
+     * @note Every stream can only be played by one AudioSource, it is driven by the AudioThread
+     */
+    class AudioStream {
+    public:
+        /// Number of OpenAL buffers queued on the source
+        static constexpr uint32_t bufferCount = 4;
+        /// Length of one buffer
+        static constexpr float bufferSeconds = 0.25f;
+
+    private:
+        AudioStream(std::vector<char> &&encoded, stb_vorbis *decoder);
+
+    public:
+        ~AudioStream();
+
+        AudioStream(const AudioStream &o) = delete;
+
+        AudioStream &operator=(const AudioStream &o) = delete;
+
+        AudioStream(AudioStream &&o) = delete;
+
+        AudioStream &operator=(AudioStream &&o) = delete;
+
+        // -------------------------------------------------------------------------------------------------------------
+
+        /// Opens an Ogg Vorbis file and starts decoding its first chunks
+        static std::unique_ptr<AudioStream> Open(const std::string &filename);
+
+        // -------------------------------------------------------------------------------------------------------------
+
+        [[nodiscard]] int getChannels() const { return channels; }
+
+        [[nodiscard]] int getSampleRate() const { return sampleRate; }
+
+        [[nodiscard]] AudioFormat getFormat() const { return format; }
+
+        /// Length of the stream in samples per channel
+        [[nodiscard]] uint32_t getLength() const { return length; }
+
+        /// Playback position in samples per channel
+        [[nodiscard]] uint32_t getPosition(uint32_t source) const;
+
+    private:
+        friend class AudioEmitter;
+
+        /// Queues decoded chunks into free buffers and restarts the source if it ran dry while playing
+        void update(uint32_t source);
+
+        /// Fills the queue before the source starts playing
+        void start(uint32_t source);
+
+        /// Removes all buffers from the stopped source and restarts decoding at the sample
+        void seek(uint32_t source, uint32_t sample);
+
+        [[nodiscard]] bool isPlaying() const { return playing; }
+
+        /// Looping is handled by the decoder, the source itself MUST NOT loop its queue
+        void setLooping(bool loop);
+
+        /// MUST be called with the mutex held
+        void requestSeek(uint32_t sample);
+
+        void decode();
+
+        void queueDecodedChunks(uint32_t source);
+
+    private:
+        std::vector<char> encoded; // stb_vorbis decodes from memory, the compressed file stays loaded
+        stb_vorbis *decoder;
+        int channels;
+        int sampleRate;
+        AudioFormat format;
+        uint32_t length;
+
+        // OpenAL buffers, only accessed from the audio thread
+        std::array<uint32_t, bufferCount> buffers{};
+        std::array<uint32_t, bufferCount> bufferSamples{}; // Samples per channel of every buffer
+        std::vector<uint32_t> freeBuffers;
+        std::deque<uint32_t> queuedBuffers;
+        uint32_t processedSamples = 0; // Samples per channel of all unqueued buffers since the start
+        bool playing = false;
+
+        // Shared with the decoder thread
+        std::mutex mutex;
+        std::condition_variable decoderWakeUp;
+        std::deque<std::vector<short>> decodedChunks;
+        bool endOfStream = false;
+        bool seekRequested = false;
+        uint32_t seekTarget = 0;
+        bool stopDecoder = false;
+        std::atomic<bool> looping = false; // Written with the mutex held to not miss a wake up
+        std::thread decoderThread;
+    };
+
+}
@@ -28,6 +28,15 @@ namespace ChaosEngine {
         body->SetTransform(b2Vec2(newPosition.x, newPosition.y), body->GetAngle());
     }
 
+    void Physics2DBody::setTransform(const Transform &transform) {
+        const b2Vec2 position(transform.position.x, transform.position.y);
+        const float angle = glm::radians(transform.rotation.z);
+        if (body->GetPosition() == position && body->GetAngle() == angle)
+            return;
+        body->SetTransform(position, angle);
+        body->SetAwake(true);
+    }
+
     void Physics2DBody::setVelocity(const glm::vec3 &velocity) {
         body->SetLinearVelocity(b2Vec2(velocity.x, velocity.y));
     }
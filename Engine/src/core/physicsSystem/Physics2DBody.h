@@ -41,6 +41,9 @@ namespace ChaosEngine {
 
         void setPosition(const glm::vec3 &newPosition);
 
+        /// Moves the body to the position and z rotation of the transform and wakes it, if they differ
+        void setTransform(const Transform &transform);
+
         void setVelocity(const glm::vec3 &velocity);
 
         void setAngularVelocity(const glm::vec3 &velocity);
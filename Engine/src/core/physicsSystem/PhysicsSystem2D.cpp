@@ -4,6 +4,9 @@
 #include "renderer/api/RendererAPI.h"
 #include <box2d/b2_collision.h>
 #include <box2d/b2_contact.h>
+#include <box2d/b2_body.h>
+
+#include <algorithm>
 
 using namespace ChaosEngine;
 
@@ -12,39 +15,67 @@ PhysicsSystem2D::Physics2DCollisionListener::Physics2DCollisionListener(ECS &ecs
 PhysicsSystem2D::Physics2DCollisionListener::~Physics2DCollisionListener() = default;
 
 void PhysicsSystem2D::Physics2DCollisionListener::BeginContact(b2Contact *contact) {
-    // Logger::D("Physics2DCollisionListener", "BeginContact");
+    record(contact, true);
+}
+
+void PhysicsSystem2D::Physics2DCollisionListener::EndContact(b2Contact *contact) {
+    // Also called outside of the step when a body is destroyed, its entity may be destroyed by the time of the dispatch
+    record(contact, false);
+}
 
+void PhysicsSystem2D::Physics2DCollisionListener::record(b2Contact *contact, bool begin) {
     const auto entityA = static_cast<entt::entity>(contact->GetFixtureA()->GetBody()->GetUserData().pointer);
     const auto entityB = static_cast<entt::entity>(contact->GetFixtureB()->GetBody()->GetUserData().pointer);
-    // LOG_DEBUG("Checking for entity {} and {}", entityA, entityB);
+    if (hasScript(entityA))
+        events.push_back(CollisionEvent{entityA, entityB, begin});
+    if (hasScript(entityB))
+        events.push_back(CollisionEvent{entityB, entityA, begin});
+}
 
-    if (ecs.getRegistry().any_of<NativeScriptComponent>(entityA)) {
-        const auto other = Entity(ecs.getEntity(entityB));
-        ecs.getRegistry().get<NativeScriptComponent>(entityA).script->onCollisionEnter(other);
+void PhysicsSystem2D::Physics2DCollisionListener::beginStep() {
+    for (const auto index: scriptedIndices) {
+        scripted[index] = entt::null;
     }
-    if (ecs.getRegistry().any_of<NativeScriptComponent>(entityB)) {
-        const auto other = Entity(ecs.getEntity(entityA));
-        ecs.getRegistry().get<NativeScriptComponent>(entityB).script->onCollisionEnter(other);
+    scriptedIndices.clear();
+    for (const auto entity: ecs.getRegistry().view<const NativeScriptComponent>()) {
+        const auto index = entt::to_entity(entity);
+        if (index >= scripted.size())
+            scripted.resize(index + 1, entt::null);
+        scripted[index] = entity;
+        scriptedIndices.push_back(index);
     }
 }
 
-void PhysicsSystem2D::Physics2DCollisionListener::EndContact(b2Contact *contact) {
-    // Logger::D("Physics2DCollisionListener", "EndContact");
-
-    const auto entityA = static_cast<entt::entity>(contact->GetFixtureA()->GetBody()->GetUserData().pointer);
-    const auto entityB = static_cast<entt::entity>(contact->GetFixtureB()->GetBody()->GetUserData().pointer);
-
-    // This check can fail when one of the entities got destroyed TODO: Fix this propperly
-    if (ecs.getRegistry().valid(entityA) && ecs.getRegistry().valid(entityB)) {
-        if (ecs.getRegistry().any_of<NativeScriptComponent>(entityA)) {
-            const auto other = Entity(ecs.getEntity(entityB));
-            ecs.getRegistry().get<NativeScriptComponent>(entityA).script->onCollisionExit(other);
-        }
-        if (ecs.getRegistry().any_of<NativeScriptComponent>(entityB)) {
-            const auto other = Entity(ecs.getEntity(entityA));
-            ecs.getRegistry().get<NativeScriptComponent>(entityB).script->onCollisionExit(other);
+void PhysicsSystem2D::Physics2DCollisionListener::dispatch() {
+    if (events.empty())
+        return;
+    // Scripts may cause new contacts, e.g. by destroying bodies, which are dispatched next time
+    dispatching.swap(events);
+    // Stable, so an entity sees its begin and end events in the order they happened
+    std::stable_sort(dispatching.begin(), dispatching.end(),
+                     [](const CollisionEvent &lhs, const CollisionEvent &rhs) { return lhs.entity < rhs.entity; });
+
+    auto &registry = ecs.getRegistry();
+    entt::entity current = entt::null;
+    NativeScript *script = nullptr;
+    for (const auto &event: dispatching) {
+        if (event.entity != current) {
+            current = event.entity;
+            const auto *component = registry.valid(current) ? registry.try_get<NativeScriptComponent>(current)
+                                                            : nullptr;
+            script = (component != nullptr) ? component->script.get() : nullptr;
         }
+        if (script == nullptr)
+            continue;
+        // Contacts of destroyed entities are still delivered, so every enter is followed by an exit
+        const auto other = registry.valid(event.other) ? ecs.getEntity(event.other)
+                                                       : ECS::getDestroyedEntity(event.other);
+        if (event.begin)
+            script->onCollisionEnter(other);
+        else
+            script->onCollisionExit(other);
     }
+    dispatching.clear();
 }
 
 void PhysicsSystem2D::Physics2DCollisionListener::PreSolve(b2Contact *,
@@ -154,7 +185,7 @@ void PhysicsSystem2D::Physics2DDebugDraw::DrawPoint(const b2Vec2 &p, float /*siz
 
 PhysicsSystem2D *PhysicsSystem2D::globalInstance = nullptr;
 
-PhysicsSystem2D::PhysicsSystem2D() : world(nullptr) {
+PhysicsSystem2D::PhysicsSystem2D(WorkerPool &workers) : workers(workers), world(nullptr) {
     assert("Global physics2D instance is already set" && globalInstance == nullptr);
     globalInstance = this;
 }
@@ -165,6 +196,7 @@ PhysicsSystem2D::~PhysicsSystem2D() {
 
 void PhysicsSystem2D::init(Scene &scene) {
     collusionListener = std::make_unique<Physics2DCollisionListener>(scene.getECS());
+    transformChanges = scene.getECS().trackChanges<Transform>();
     world = &scene.getPhysicsWorld().getPhysicsWorldRef();
     world->SetContactListener(collusionListener.get());
 
@@ -173,19 +205,74 @@ void PhysicsSystem2D::init(Scene &scene) {
     world->SetDebugDraw(debugDrawer.get());
 }
 
+void PhysicsSystem2D::unload() {
+    transformChanges = nullptr;
+}
+
 void PhysicsSystem2D::update(ECS &ecs, float deltaTime) {
     if (world == nullptr)
         return;
 
+    pushTransformChanges(ecs);
+    collusionListener->beginStep();
     world->Step(deltaTime, velocityIterations, positionIterations);
+    pullAwakeTransforms(ecs);
+
+    // Scripts see the synchronized Transforms
+    collusionListener->dispatch();
+}
+
+void PhysicsSystem2D::pushTransformChanges(ECS &ecs) {
+    auto &registry = ecs.getRegistry();
+    transformChanges->each([&registry](entt::entity entity) {
+        const auto *transform = registry.try_get<Transform>(entity);
+        if (transform == nullptr)
+            return;
+        if (auto *dynamicBody = registry.try_get<DynamicRigidBodyComponent>(entity))
+            dynamicBody->body.setTransform(*transform);
+        else if (auto *staticBody = registry.try_get<StaticRigidBodyComponent>(entity))
+            staticBody->body.setTransform(*transform);
+    });
+}
+
+void PhysicsSystem2D::pullAwakeTransforms(ECS &ecs) {
+    awakeBodies.clear();
+    for (b2Body *body = world->GetBodyList(); body != nullptr; body = body->GetNext()) {
+        if (body->GetType() != b2_staticBody && body->IsAwake())
+            awakeBodies.push_back(body);
+    }
+    movedBodies.assign(awakeBodies.size(), 0);
+
+    auto &registry = ecs.getRegistry();
+    auto transforms = registry.view<Transform>();
+    // Bodies are only read, every body writes the Transform of its own entity
+    ecs.getComponentAccess().acquire<Transform>();
+    workers.parallelFor(awakeBodies.size(), syncChunkSize, [this, &transforms](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const b2Body *body = awakeBodies[i];
+            const auto entity = static_cast<entt::entity>(body->GetUserData().pointer);
+            if (!transforms.contains(entity))
+                continue;
+            auto &transform = transforms.get<Transform>(entity);
+            const b2Vec2 &position = body->GetPosition();
+            const float rotation = glm::degrees(body->GetAngle());
+            if (transform.position.x == position.x && transform.position.y == position.y &&
+                transform.rotation.z == rotation)
+                continue;
+            transform.position.x = position.x;
+            transform.position.y = position.y;
+            transform.rotation.z = rotation;
+            movedBodies[i] = 1;
+        }
+    });
+    ecs.getComponentAccess().release<Transform>();
 
-    auto view = ecs.getRegistry().view<Transform, DynamicRigidBodyComponent>();
-    for (auto [entity, transform, body]: view.each()) {
-        const Transform phyTransform = body.body.getTransform();
-        transform.position.x = phyTransform.position.x;
-        transform.position.y = phyTransform.position.y;
-        transform.rotation.z = glm::degrees(phyTransform.rotation.z);
+    // Change trackers are notified on the main thread, the own tracker only keeps changes made outside of physics
+    for (size_t i = 0; i < awakeBodies.size(); ++i) {
+        if (movedBodies[i])
+            registry.patch<Transform>(static_cast<entt::entity>(awakeBodies[i]->GetUserData().pointer));
     }
+    transformChanges->clear();
 }
 
 std::shared_ptr<Renderer::DebugRenderData> PhysicsSystem2D::getDebugData() {
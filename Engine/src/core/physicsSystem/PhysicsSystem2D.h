@@ -3,6 +3,9 @@
 #include <box2d/b2_world.h>
 #include <box2d/b2_draw.h>
 
+#include <vector>
+#include <cstdint>
+
 #include <core/Scene.h>
 #include "Physics2DBody.h"
 
@@ -16,6 +19,11 @@ namespace Renderer {
 namespace ChaosEngine {
 
     class PhysicsSystem2D {
+        /**
+         * Records the contacts of entities with scripts during the step, the scripts are notified in a batch after it.
+         * Entities without scripts are filtered out by a table of the scripted entities by index, which is refreshed
+         * before every step. The table holds the whole entity, so a recycled index does not pass as scripted.
+         */
         class Physics2DCollisionListener : public b2ContactListener {
         public:
             explicit Physics2DCollisionListener(ECS &ecs);
@@ -30,8 +38,34 @@ namespace ChaosEngine {
 
             void PostSolve(b2Contact *contact, const b2ContactImpulse *impulse) override;
 
+            /// Flags the entities with scripts, MUST be called before the step
+            void beginStep();
+
+            /// Notifies the scripts of the recorded contacts grouped by entity, skips events of destroyed scripts.
+            /// Other entities destroyed meanwhile are passed as a handle which is null but keeps its id
+            void dispatch();
+
+        private:
+            struct CollisionEvent {
+                entt::entity entity;
+                entt::entity other;
+                bool begin;
+            };
+
+            void record(b2Contact *contact, bool begin);
+
+            [[nodiscard]] bool hasScript(entt::entity entity) const {
+                const auto index = entt::to_entity(entity);
+                return index < scripted.size() && scripted[index] == entity;
+            }
+
         private:
             ECS &ecs;
+            std::vector<CollisionEvent> events{};
+            std::vector<CollisionEvent> dispatching{};
+            // Indexed by entity index, null if the entity at the index has no script
+            std::vector<entt::entity> scripted{};
+            std::vector<uint32_t> scriptedIndices{};
         };
 
         class Physics2DDebugDraw : public b2Draw {
@@ -72,12 +106,19 @@ namespace ChaosEngine {
         };
 
     public:
-        PhysicsSystem2D();
+        explicit PhysicsSystem2D(WorkerPool &workers);
 
         ~PhysicsSystem2D();
 
         void init(Scene &scene);
 
+        /// Releases the registry of the scene, MUST be called before the scene is destroyed
+        void unload();
+
+        /**
+         * Pushes Transforms changed outside of physics into their bodies, steps the world and writes the poses of the
+         * awake bodies back into their Transforms. Sleeping bodies cost nothing.
+         */
         void update(ECS &ecs, float deltaTime);
 
         std::shared_ptr<Renderer::DebugRenderData> getDebugData();
@@ -94,10 +135,21 @@ namespace ChaosEngine {
 
         Physics2DBody createBody(const b2BodyDef &def) { return Physics2DBody{world->CreateBody(&def)}; }
 
+        void pushTransformChanges(ECS &ecs);
+
+        void pullAwakeTransforms(ECS &ecs);
+
     private:
+        WorkerPool &workers;
         b2World *world;
         std::unique_ptr<Physics2DCollisionListener> collusionListener = nullptr;
         std::unique_ptr<Physics2DDebugDraw> debugDrawer = nullptr;
+        // Transforms changed since the last sync, e.g. by scripts or the editor
+        std::unique_ptr<ChangeTracker<Transform>> transformChanges = nullptr;
+        std::vector<b2Body *> awakeBodies{};
+        // Per awake body, bytes so the workers do not share bits
+        std::vector<uint8_t> movedBodies{};
+        static constexpr size_t syncChunkSize = 256;
 
         // Based on recommended values of Box2D
         // See: https://box2d.org/documentation/md__d_1__git_hub_box2d_docs_hello.html#autotoc_md24
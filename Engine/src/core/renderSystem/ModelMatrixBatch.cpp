@@ -0,0 +1,49 @@
+#include "ModelMatrixBatch.h"
+#include "ModelMatrixKernels.h"
+
+#include <algorithm>
+
+using namespace ChaosEngine;
+
+using Lanes = ModelMatrixKernels::NativeLanes;
+
+void ModelMatrixBatch::push(const Transform &transform, GLMCustomExtension::Affine2D &target) {
+    components[0].push_back(transform.position.x);
+    components[1].push_back(transform.position.y);
+    components[2].push_back(transform.position.z);
+    components[3].push_back(transform.rotation.x);
+    components[4].push_back(transform.rotation.y);
+    components[5].push_back(transform.rotation.z);
+    components[6].push_back(transform.scale.x);
+    components[7].push_back(transform.scale.y);
+    targets.push_back(&target);
+}
+
+void ModelMatrixBatch::flush() {
+    const size_t count = targets.size();
+    if (count == 0)
+        return;
+    // Pad to full lanes so the kernel never reads past the end
+    const size_t padded = (count + Lanes::width - 1) / Lanes::width * Lanes::width;
+    for (auto &component: components)
+        component.resize(padded, 0.0f);
+
+    float out[7][Lanes::width];
+    for (size_t first = 0; first < count; first += Lanes::width) {
+        std::array<const float *, 8> in{};
+        for (size_t c = 0; c < in.size(); ++c)
+            in[c] = components[c].data() + first;
+        ModelMatrixKernels::computeModelMatrices<Lanes>(in, out);
+
+        const size_t lanes = std::min(Lanes::width, count - first);
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            auto &target = *targets[first + lane];
+            target.linear = glm::vec4(out[0][lane], out[1][lane], out[2][lane], out[3][lane]);
+            target.translation = glm::vec4(out[4][lane], out[5][lane], out[6][lane], 0);
+        }
+    }
+
+    for (auto &component: components)
+        component.clear();
+    targets.clear();
+}
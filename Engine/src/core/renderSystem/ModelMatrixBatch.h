@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <entt/entity/registry.hpp>
+
+#include "Engine/src/core/Components.h"
+
+namespace ChaosEngine {
+
+    /**
+     * Computes the 2D model matrices of many transforms at once.
+     * The scheduled transforms are gathered as a structure of arrays, the matrices are then computed 8 at a time with
+     * AVX, 4 at a time with SSE2 or one at a time if neither is available.
+     */
+    class ModelMatrixBatch {
+    public:
+        ModelMatrixBatch() = default;
+
+        ~ModelMatrixBatch() = default;
+
+        ModelMatrixBatch(const ModelMatrixBatch &o) = delete;
+
+        ModelMatrixBatch &operator=(const ModelMatrixBatch &o) = delete;
+
+        /// Schedules the matrix of the transform to be written to the target by the next flush
+        void push(const Transform &transform, GLMCustomExtension::Affine2D &target);
+
+        /// Schedules the cache to be recomputed if the source differs from the transform it was computed from
+        bool update(ModelMatrixCache &cache, const Transform &source) {
+            if (cache.source == source)
+                return false;
+            cache.source = source;
+            push(source, cache.matrix);
+            return true;
+        }
+
+        /// Computes all scheduled matrices, the targets MUST still be valid
+        void flush();
+
+        [[nodiscard]] size_t size() const { return targets.size(); }
+
+    private:
+        // Position, rotation and x and y scale components of the scheduled transforms, the z scale has no effect in 2D
+        std::array<std::vector<float>, 8> components{};
+        std::vector<GLMCustomExtension::Affine2D *> targets{};
+    };
+
+    /// Adds an invalid cache to all entities with the required components that do not have one yet
+    template<typename Cache, typename... Required>
+    void addMissingCaches(entt::registry &registry) {
+        auto view = registry.view<const Required...>(entt::exclude<Cache>);
+        const std::vector<entt::entity> missing(view.begin(), view.end());
+        registry.insert<Cache>(missing.begin(), missing.end());
+    }
+
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CHAOS_MODEL_MATRIX_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * Branch free kernels of the ModelMatrixBatch, written once against a lane type.
+ * Scalar lanes are always available, SSE2 and AVX lanes when the build targets them. The batch uses the widest.
+ */
+namespace ChaosEngine::ModelMatrixKernels {
+
+    // ---- Lanes ----
+    // Flags are lanes holding either 0 or 1.
+
+    struct ScalarLanes {
+        static constexpr size_t width = 1;
+        float v;
+
+        static ScalarLanes load(const float *p) { return {*p}; }
+
+        static ScalarLanes set(float f) { return {f}; }
+
+        void store(float *p) const { *p = v; }
+
+        friend ScalarLanes operator+(ScalarLanes a, ScalarLanes b) { return {a.v + b.v}; }
+
+        friend ScalarLanes operator-(ScalarLanes a, ScalarLanes b) { return {a.v - b.v}; }
+
+        friend ScalarLanes operator*(ScalarLanes a, ScalarLanes b) { return {a.v * b.v}; }
+
+        friend ScalarLanes abs(ScalarLanes a) { return {std::abs(a.v)}; }
+
+        friend ScalarLanes floorPositive(ScalarLanes a) { return {std::floor(a.v)}; }
+
+        friend ScalarLanes isNegative(ScalarLanes a) { return {(a.v < 0) ? 1.0f : 0.0f}; }
+
+        friend ScalarLanes select(ScalarLanes flag, ScalarLanes a, ScalarLanes b) { return (flag.v != 0) ? a : b; }
+    };
+
+#if defined(CHAOS_MODEL_MATRIX_SSE2)
+
+    struct SSE2Lanes {
+        static constexpr size_t width = 4;
+        __m128 v;
+
+        static SSE2Lanes load(const float *p) { return {_mm_loadu_ps(p)}; }
+
+        static SSE2Lanes set(float f) { return {_mm_set1_ps(f)}; }
+
+        void store(float *p) const { _mm_storeu_ps(p, v); }
+
+        friend SSE2Lanes operator+(SSE2Lanes a, SSE2Lanes b) { return {_mm_add_ps(a.v, b.v)}; }
+
+        friend SSE2Lanes operator-(SSE2Lanes a, SSE2Lanes b) { return {_mm_sub_ps(a.v, b.v)}; }
+
+        friend SSE2Lanes operator*(SSE2Lanes a, SSE2Lanes b) { return {_mm_mul_ps(a.v, b.v)}; }
+
+        friend SSE2Lanes abs(SSE2Lanes a) { return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v)}; }
+
+        // Truncation equals floor for positive values, SSE2 has no rounding instruction
+        friend SSE2Lanes floorPositive(SSE2Lanes a) { return {_mm_cvtepi32_ps(_mm_cvttps_epi32(a.v))}; }
+
+        friend SSE2Lanes isNegative(SSE2Lanes a) {
+            return {_mm_and_ps(_mm_cmplt_ps(a.v, _mm_setzero_ps()), _mm_set1_ps(1.0f))};
+        }
+
+        friend SSE2Lanes select(SSE2Lanes flag, SSE2Lanes a, SSE2Lanes b) {
+            const __m128 mask = _mm_cmpneq_ps(flag.v, _mm_setzero_ps());
+            return {_mm_or_ps(_mm_and_ps(mask, a.v), _mm_andnot_ps(mask, b.v))};
+        }
+    };
+
+#endif
+#if defined(__AVX__)
+
+    struct AVXLanes {
+        static constexpr size_t width = 8;
+        __m256 v;
+
+        static AVXLanes load(const float *p) { return {_mm256_loadu_ps(p)}; }
+
+        static AVXLanes set(float f) { return {_mm256_set1_ps(f)}; }
+
+        void store(float *p) const { _mm256_storeu_ps(p, v); }
+
+        friend AVXLanes operator+(AVXLanes a, AVXLanes b) { return {_mm256_add_ps(a.v, b.v)}; }
+
+        friend AVXLanes operator-(AVXLanes a, AVXLanes b) { return {_mm256_sub_ps(a.v, b.v)}; }
+
+        friend AVXLanes operator*(AVXLanes a, AVXLanes b) { return {_mm256_mul_ps(a.v, b.v)}; }
+
+        friend AVXLanes abs(AVXLanes a) { return {_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v)}; }
+
+        friend AVXLanes floorPositive(AVXLanes a) { return {_mm256_floor_ps(a.v)}; }
+
+        friend AVXLanes isNegative(AVXLanes a) {
+            return {_mm256_and_ps(_mm256_cmp_ps(a.v, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(1.0f))};
+        }
+
+        friend AVXLanes select(AVXLanes flag, AVXLanes a, AVXLanes b) {
+            return {_mm256_blendv_ps(b.v, a.v, _mm256_cmp_ps(flag.v, _mm256_setzero_ps(), _CMP_NEQ_OQ))};
+        }
+    };
+
+#endif
+
+#if defined(__AVX__)
+    using NativeLanes = AVXLanes;
+#elif defined(CHAOS_MODEL_MATRIX_SSE2)
+    using NativeLanes = SSE2Lanes;
+#else
+    using NativeLanes = ScalarLanes;
+#endif
+
+    template<typename Lanes>
+    inline Lanes negateIf(Lanes a, Lanes flag) { return a * (Lanes::set(1) - flag * Lanes::set(2)); }
+
+    template<typename Lanes>
+    inline Lanes exclusiveOr(Lanes a, Lanes b) { return a + b - a * b * Lanes::set(2); }
+
+    // ---- Kernels ----
+
+    /// Cephes single precision sine and cosine, branch free so all lanes take the same path
+    template<typename Lanes>
+    void sinCos(Lanes x, Lanes &sin, Lanes &cos) {
+        const Lanes negative = isNegative(x);
+        x = abs(x);
+
+        // Quarter turns to the nearest multiple of pi/2, the polynomials cover the remaining [-pi/4, pi/4]
+        const Lanes quadrant = floorPositive((x * Lanes::set(1.27323954473516f) + Lanes::set(1)) * Lanes::set(0.5f));
+        const Lanes octant = quadrant * Lanes::set(2);
+        // Extended precision subtraction of octant * pi/4
+        x = x - octant * Lanes::set(0.78515625f);
+        x = x - octant * Lanes::set(2.4187564849853515625e-4f);
+        x = x - octant * Lanes::set(3.77489497744594108e-8f);
+
+        const Lanes z = x * x;
+        const Lanes cosPoly = ((Lanes::set(2.443315711809948e-5f) * z - Lanes::set(1.388731625493765e-3f)) * z +
+                               Lanes::set(4.166664568298827e-2f)) * z * z - z * Lanes::set(0.5f) + Lanes::set(1);
+        const Lanes sinPoly = ((Lanes::set(-1.9515295891e-4f) * z + Lanes::set(8.3321608736e-3f)) * z -
+                               Lanes::set(1.6666654611e-1f)) * z * x + x;
+
+        const Lanes odd = quadrant - floorPositive(quadrant * Lanes::set(0.5f)) * Lanes::set(2);
+        const Lanes quadrantMod4 = quadrant - floorPositive(quadrant * Lanes::set(0.25f)) * Lanes::set(4);
+        const Lanes lowerHalf = floorPositive(quadrantMod4 * Lanes::set(0.5f)); // Quadrant 2 or 3 of the circle
+        sin = negateIf(select(odd, cosPoly, sinPoly), exclusiveOr(negative, lowerHalf));
+        cos = negateIf(select(odd, sinPoly, cosPoly), exclusiveOr(odd, lowerHalf));
+    }
+
+    /**
+     * Computes translate(position) * toMat4(quat(radians(rotation))) * scale(scale) for all lanes, reduced to the x and
+     * y axes and the translation.
+     * @param in Position, rotation in degrees and x and y scale components, each starting at the first lane
+     * @param out Linear part column major followed by the translation, each with the width of the lanes
+     */
+    template<typename Lanes>
+    void computeModelMatrices(const std::array<const float *, 8> &in, float (&out)[7][Lanes::width]) {
+        // Half angles in radians for the quaternion
+        const Lanes halfRadians = Lanes::set(0.00872664625997164788f);
+        Lanes sx{}, cx{}, sy{}, cy{}, sz{}, cz{};
+        sinCos(Lanes::load(in[3]) * halfRadians, sx, cx);
+        sinCos(Lanes::load(in[4]) * halfRadians, sy, cy);
+        sinCos(Lanes::load(in[5]) * halfRadians, sz, cz);
+
+        // Same component order as glm::quat(glm::vec3 eulerAngles)
+        const Lanes w = cx * cy * cz + sx * sy * sz;
+        const Lanes x = sx * cy * cz - cx * sy * sz;
+        const Lanes y = cx * sy * cz + sx * cy * sz;
+        const Lanes z = cx * cy * sz - sx * sy * cz;
+
+        const Lanes two = Lanes::set(2);
+        const Lanes one = Lanes::set(1);
+        const Lanes xy = x * y, wz = w * z, zz = z * z;
+
+        const Lanes scaleX = Lanes::load(in[6]);
+        const Lanes scaleY = Lanes::load(in[7]);
+        (scaleX * (one - two * (y * y + zz))).store(out[0]);
+        (scaleX * (two * (xy + wz))).store(out[1]);
+        (scaleY * (two * (xy - wz))).store(out[2]);
+        (scaleY * (one - two * (x * x + zz))).store(out[3]);
+
+        Lanes::load(in[0]).store(out[4]);
+        Lanes::load(in[1]).store(out[5]);
+        Lanes::load(in[2]).store(out[6]);
+    }
+
+}
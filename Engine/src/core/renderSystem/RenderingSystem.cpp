@@ -12,8 +12,8 @@ using namespace Renderer;
 std::unique_ptr<GraphicsContext> RenderingSystem::Context = nullptr;
 std::unique_ptr<RendererAPI> RenderingSystem::Renderer = nullptr;
 
-RenderingSystem::RenderingSystem(Window &window, GraphicsAPI api)
-        : uiRenderSubSystem(std::make_unique<UIRenderSubSystem>()) {
+RenderingSystem::RenderingSystem(Window &window, GraphicsAPI api, WorkerPool &workers)
+        : uiRenderSubSystem(std::make_unique<UIRenderSubSystem>()), transformHierarchy(workers) {
     Context = Renderer::GraphicsContext::Create(window, api);
 }
 
@@ -59,8 +59,8 @@ void RenderingSystem::updateComponents(ECS &/*ecs*/) {
 
 void RenderingSystem::renderEntities(ECS &ecs, const std::optional<std::shared_ptr<DebugRenderData>>& debugData) {
     assert("Renderer must be initialized" && Renderer != nullptr);
-    auto view = ecs.getRegistry().view<const Transform, const RenderComponent>();
-    auto cameras = ecs.getRegistry().view<const Transform, const CameraComponent>();
+    transformHierarchy.update(ecs);
+    auto cameras = ecs.getRegistry().view<const WorldMatrixComponent, const CameraComponent>();
 
     Context->beginFrame();
     Renderer->beginFrame();
@@ -68,9 +68,9 @@ void RenderingSystem::renderEntities(ECS &ecs, const std::optional<std::shared_p
     bool rendered = false;
     glm::mat4 modelMat{};
     CameraComponent currentCamera{};
-    for (const auto&[entity, transform, camera]: cameras.each()) {
+    for (const auto&[entity, world, camera]: cameras.each()) {
         if (camera.active && !rendered) {
-            modelMat = transform.getModelMatrix();
+            modelMat = GLMCustomExtension::toMat4(world.matrix);
             currentCamera = camera;
             Renderer->beginScene(modelMat, currentCamera);
             rendered = true;
@@ -83,8 +83,11 @@ void RenderingSystem::renderEntities(ECS &ecs, const std::optional<std::shared_p
         assert("There was no active camera so nothing was rendered!");
     }
 
-    for (const auto&[entity, transform, renderComp]: view.each()) {
-        Renderer->draw(transform.getModelMatrix(), renderComp);
+    // Command recording is not thread safe, the owning group keeps the components packed in the order they are drawn
+    auto drawables = ecs.getRegistry().group<WorldMatrixComponent, RenderComponent>();
+    for (const auto &[entity, world, renderComp]: drawables.each()) {
+        if (renderComp.mesh != nullptr && renderComp.materialInstance != nullptr)
+            Renderer->draw(world.matrix, renderComp);
     }
     if(debugData)
         Renderer->drawSceneDebug(modelMat, currentCamera, **debugData);
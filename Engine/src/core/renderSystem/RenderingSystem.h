@@ -8,12 +8,13 @@
 #include "Engine/src/renderer/api/RendererAPI.h"
 #include "Engine/src/renderer/api/GraphicsContext.h"
 #include "UIRenderSubSystem.h"
+#include "TransformHierarchy.h"
 
 namespace ChaosEngine {
 
     class RenderingSystem {
     public:
-        RenderingSystem(Window &window, Renderer::GraphicsAPI api);
+        RenderingSystem(Window &window, Renderer::GraphicsAPI api, WorkerPool &workers);
 
         ~RenderingSystem();
 
@@ -38,6 +39,7 @@ namespace ChaosEngine {
 
     private:
         std::unique_ptr<UIRenderSubSystem> uiRenderSubSystem;
+        TransformHierarchy transformHierarchy;
     private:
         static std::unique_ptr<Renderer::GraphicsContext> Context;
         static std::unique_ptr<Renderer::RendererAPI> Renderer;
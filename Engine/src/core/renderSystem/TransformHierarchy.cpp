@@ -0,0 +1,126 @@
+#include "TransformHierarchy.h"
+
+using namespace ChaosEngine;
+
+// Parents without a Transform are placed at the origin, generation 0 never counts as a change
+static const WorldMatrixComponent origin{};
+
+void TransformHierarchy::update(ECS &ecs) {
+    auto &registry = ecs.getRegistry();
+    // Generation 0 marks matrices which were never computed
+    if (++generation == 0)
+        generation = 1;
+
+    const bool sorted = validate(registry);
+    addMissingCaches<WorldMatrixComponent, Transform>(registry);
+    addMissingCaches<LocalMatrixComponent, Transform, ParentComponent>(registry);
+
+    // Entities which lost their parent are roots again, their world matrix is recomputed from the Transform
+    auto lostParent = registry.view<const LocalMatrixComponent>(entt::exclude<ParentComponent>);
+    detached.assign(lostParent.begin(), lostParent.end());
+    for (auto entity: detached) {
+        registry.remove<LocalMatrixComponent>(entity);
+        if (auto *world = registry.try_get<WorldMatrixComponent>(entity))
+            *world = WorldMatrixComponent{};
+    }
+
+    // Only transforms that changed since the last update are recomputed
+    auto roots = registry.view<const Transform, WorldMatrixComponent>(entt::exclude<ParentComponent>);
+    for (auto &&[entity, transform, world]: roots.each()) {
+        if (matrixBatch.update(world, transform))
+            world.generation = generation;
+    }
+    auto children = registry.view<const Transform, const ParentComponent, LocalMatrixComponent>();
+    for (auto &&[entity, transform, parent, local]: children.each()) {
+        if (matrixBatch.update(local, transform) || local.parent != parent.parent) {
+            local.parent = parent.parent;
+            local.generation = generation;
+        }
+    }
+    matrixBatch.flush();
+
+    if (registry.view<const ParentComponent>().empty())
+        return;
+    if (!sorted)
+        sortByDepth(registry);
+    propagate(registry);
+}
+
+bool TransformHierarchy::validate(entt::registry &registry) {
+    detached.clear();
+    bool sorted = true;
+    uint32_t previousDepth = 0;
+    for (auto &&[entity, parent]: registry.view<const ParentComponent>().each()) {
+        if (!registry.valid(parent.parent)) {
+            detached.push_back(entity);
+            continue;
+        }
+        const auto *grandParent = registry.try_get<ParentComponent>(parent.parent);
+        const uint32_t depth = (grandParent == nullptr) ? 1 : grandParent->depth + 1;
+        if (parent.depth != depth || parent.depth < previousDepth)
+            sorted = false;
+        previousDepth = parent.depth;
+    }
+
+    // Parents destroyed directly on the registry, ECS::removeEntity removes the children together with the parent
+    for (auto entity: detached) {
+        registry.remove<ParentComponent>(entity);
+    }
+    return sorted && detached.empty();
+}
+
+void TransformHierarchy::sortByDepth(entt::registry &registry) {
+    for (auto &&[entity, parent]: registry.view<ParentComponent>().each()) {
+        uint32_t depth = 1;
+        for (const auto *ancestor = registry.try_get<ParentComponent>(parent.parent); ancestor != nullptr;
+             ancestor = registry.try_get<ParentComponent>(ancestor->parent)) {
+            ++depth;
+        }
+        parent.depth = depth;
+    }
+    registry.sort<ParentComponent>([](const ParentComponent &lhs, const ParentComponent &rhs) {
+        return lhs.depth < rhs.depth;
+    });
+}
+
+void TransformHierarchy::propagate(entt::registry &registry) {
+    nodes.clear();
+    levelEnds.clear();
+    uint32_t depth = 0;
+    for (auto &&[entity, parent]: registry.view<const ParentComponent>().each()) {
+        auto *world = registry.try_get<WorldMatrixComponent>(entity);
+        const auto *local = registry.try_get<LocalMatrixComponent>(entity);
+        if (world == nullptr || local == nullptr)
+            continue; // Without a Transform
+        if (parent.depth != depth && !nodes.empty())
+            levelEnds.push_back(nodes.size());
+        depth = parent.depth;
+        const auto *parentWorld = registry.try_get<WorldMatrixComponent>(parent.parent);
+        nodes.push_back(Node{world, local, (parentWorld != nullptr) ? parentWorld : &origin});
+    }
+    levelEnds.push_back(nodes.size());
+
+    // A node only reads the world matrix of its parent, which is one level above
+    const auto updateNodes = [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Node &node = nodes[i];
+            if (node.local->generation != generation && node.parentWorld->generation != generation &&
+                node.world->generation != 0)
+                continue;
+            node.world->matrix = GLMCustomExtension::combine(node.parentWorld->matrix, node.local->matrix);
+            node.world->generation = generation;
+        }
+    };
+
+    size_t levelBegin = 0;
+    for (const size_t levelEnd: levelEnds) {
+        if (levelEnd - levelBegin >= parallelThreshold) {
+            workers.parallelFor(levelEnd - levelBegin, chunkSize, [&](size_t begin, size_t end) {
+                updateNodes(levelBegin + begin, levelBegin + end);
+            });
+        } else {
+            updateNodes(levelBegin, levelEnd);
+        }
+        levelBegin = levelEnd;
+    }
+}
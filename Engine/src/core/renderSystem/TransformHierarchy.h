@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+
+#include "Engine/src/core/Ecs.h"
+#include "Engine/src/core/utils/WorkerPool.h"
+#include "ModelMatrixBatch.h"
+
+namespace ChaosEngine {
+
+    /**
+     * Maintains the WorldMatrixComponents of all entities with a Transform.
+     * Entities with a ParentComponent are stored sorted by depth, so every parent is processed before its children. A
+     * world matrix is only recomputed if its own Transform or the world matrix of its parent changed, unchanged
+     * subtrees cost a comparison per entity. Entities at the same depth are independent of each other, large levels
+     * are processed on the workers.
+     */
+    class TransformHierarchy {
+    public:
+        /// Levels with fewer entities are processed serially
+        static constexpr size_t parallelThreshold = 4096;
+        static constexpr size_t chunkSize = 1024;
+
+    public:
+        explicit TransformHierarchy(WorkerPool &workers) : workers(workers) {}
+
+        ~TransformHierarchy() = default;
+
+        TransformHierarchy(const TransformHierarchy &o) = delete;
+
+        TransformHierarchy &operator=(const TransformHierarchy &o) = delete;
+
+        /// Recomputes the world matrices of all changed subtrees
+        void update(ECS &ecs);
+
+    private:
+        /// Detaches children of destroyed entities, returns false if the children are not sorted by depth
+        bool validate(entt::registry &registry);
+
+        void sortByDepth(entt::registry &registry);
+
+        void propagate(entt::registry &registry);
+
+    private:
+        struct Node {
+            WorldMatrixComponent *world;
+            const LocalMatrixComponent *local;
+            const WorldMatrixComponent *parentWorld;
+        };
+
+        WorkerPool &workers;
+        ModelMatrixBatch matrixBatch{};
+        uint32_t generation = 0;
+        // Reused every update
+        std::vector<Node> nodes{};
+        std::vector<size_t> levelEnds{};
+        std::vector<entt::entity> detached{};
+    };
+
+}
@@ -103,53 +103,64 @@ UIRenderSubSystem::renderTextToBuffers(uint32_t bufferOffsetInGlyphs, VertexPCU
     return glyphCount;
 }
 
-static glm::mat4
-calculateTextModelMatrix(const Transform &transform,
-                         const glm::vec3 scaleOffset = glm::vec3(0),
-                         const UIComponent &uiC = UIComponent{false, glm::vec3(0), glm::vec3(0), glm::vec3(0)}) {
+/// The transform in UI space the model matrix of the UI element is computed from
+static Transform
+calculateUITransform(const Transform &transform,
+                     const glm::vec3 scaleOffset = glm::vec3(0),
+                     const UIComponent &uiC = UIComponent{false, glm::vec3(0), glm::vec3(0), glm::vec3(0)}) {
     auto pos = transform.position + uiC.offsetPosition;
-    const auto rot = transform.rotation + uiC.offsetRotation;
-    const auto scl = transform.scale + uiC.offsetScale + scaleOffset;
     pos.y *= -1;
-    glm::mat4 modelMat = glm::translate(glm::mat4(1), pos);
-    modelMat *= glm::toMat4(glm::quat(glm::vec3{glm::radians(rot.x), glm::radians(rot.y),
-                                                glm::radians(rot.z)}));
-    return glm::scale(modelMat, scl);
+    return Transform{pos, transform.rotation + uiC.offsetRotation, transform.scale + uiC.offsetScale + scaleOffset};
+}
+
+void UIRenderSubSystem::updateModelMatrices(ECS &ecs) {
+    auto &registry = ecs.getRegistry();
+    addMissingCaches<UIMatrixComponent, Transform, UIRenderComponent>(registry);
+    addMissingCaches<UITextMatrixComponent, Transform, UITextComponent>(registry);
+
+    const auto uiComps = registry.view<const Transform, const UIRenderComponent, UIMatrixComponent>();
+    for (auto &&[entity, transform, ui, matrix]: uiComps.each()) {
+        const auto *uiC = registry.try_get<UIComponent>(entity);
+        if (uiC == nullptr)
+            matrixBatch.update(matrix, calculateUITransform(transform, ui.scaleOffset));
+        else
+            matrixBatch.update(matrix, calculateUITransform(transform, ui.scaleOffset, *uiC));
+    }
+    const auto uiTexts = registry.view<const Transform, const UITextComponent, UITextMatrixComponent>();
+    for (auto &&[entity, transform, text, matrix]: uiTexts.each()) {
+        matrixBatch.update(matrix, calculateUITransform(transform));
+    }
+    matrixBatch.flush();
 }
 
 void UIRenderSubSystem::render(ECS &ecs, Renderer::RendererAPI &renderer) {
+    updateModelMatrices(ecs);
     // Render UI elements
     {
         renderer.beginUI(glm::mat4(1.0f));
-        const auto uiComps = ecs.getRegistry().view<const Transform, const UIRenderComponent>();
-        for (auto &&[entity, transform, ui]: uiComps.each()) {
-            const auto *uiC = ecs.getRegistry().try_get<UIComponent>(entity);
-            if (uiC == nullptr)
-                renderer.drawUI(calculateTextModelMatrix(transform, ui.scaleOffset), *ui.mesh, *ui.materialInstance);
-            else
-                renderer.drawUI(calculateTextModelMatrix(transform, ui.scaleOffset, *uiC), *ui.mesh,
-                                *ui.materialInstance);
+        const auto uiComps = ecs.getRegistry().view<const UIMatrixComponent, const UIRenderComponent>();
+        for (auto &&[entity, matrix, ui]: uiComps.each()) {
+            renderer.drawUI(matrix.matrix, *ui.mesh, *ui.materialInstance);
         }
         renderer.endUI();
     }
     // Render Text
     {
-        auto uiTexts = ecs.getRegistry().view<Transform, UITextComponent>();
+        auto uiTexts = ecs.getRegistry().view<const UITextMatrixComponent, UITextComponent>();
         uint32_t totalGlyphCount = 0;
         auto *vBufferRef = static_cast<VertexPCU *>(textVertexBuffers[currentBufferedFrame]->map());
         auto *iBufferRef = static_cast<uint32_t *>(textIndexBuffers[currentBufferedFrame]->map());
 
         renderer.beginTextOverlay(glm::mat4(1.0f));
-        for (auto &&[entity, transform, text]: uiTexts.each()) {
+        for (auto &&[entity, matrix, text]: uiTexts.each()) {
             if (!fontMaterialInstances.contains(text.font.get())) {
                 auto fontTexture = text.font->getFontTexture();
                 fontMaterialInstances[text.font.get()] = uiTextMaterial.instantiate(nullptr, 0, {fontTexture});
             }
 
             auto glyphCount = renderTextToBuffers(totalGlyphCount, vBufferRef, iBufferRef, text, glm::vec3());
-            glm::mat4 modelMat = calculateTextModelMatrix(transform);
             renderer.drawText(*textVertexBuffers[currentBufferedFrame], *textIndexBuffers[currentBufferedFrame],
-                            glyphCount * 6, totalGlyphCount * 6, modelMat, *fontMaterialInstances[text.font.get()]);
+                            glyphCount * 6, totalGlyphCount * 6, matrix.matrix, *fontMaterialInstances[text.font.get()]);
 
             totalGlyphCount += glyphCount;
         }
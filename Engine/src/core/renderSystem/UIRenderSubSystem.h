@@ -4,6 +4,7 @@
 #include "Engine/src/core/assets/Mesh.h"
 #include "Engine/src/renderer/api/RendererAPI.h"
 #include "Engine/src/renderer/api/Buffer.h"
+#include "ModelMatrixBatch.h"
 
 namespace ChaosEngine {
 
@@ -16,6 +17,9 @@ namespace ChaosEngine {
         void render(ECS &ecs, Renderer::RendererAPI &renderer);
 
     private:
+        /// Recomputes the model matrices of all UI elements and texts whose transform changed
+        void updateModelMatrices(ECS &ecs);
+
         uint32_t renderTextToBuffers(uint32_t bufferOffsetInGlyphs, VertexPCU *vBufferRef, uint32_t *iBufferRef,
                                      const UITextComponent &text, glm::vec3 linePos) const;
 
@@ -26,6 +30,7 @@ namespace ChaosEngine {
         std::vector<std::unique_ptr<Renderer::Buffer>> textIndexBuffers{};
         Renderer::MaterialRef uiTextMaterial = Renderer::MaterialRef(nullptr);
         std::unordered_map<const Font *, std::shared_ptr<Renderer::MaterialInstance>> fontMaterialInstances{};
+        ModelMatrixBatch matrixBatch{};
     };
 
 }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Engine/src/core/Ecs.h"
+#include "Engine/src/core/ParallelView.h"
+
+namespace ChaosEngine {
+    class NativeScriptSystem;
+
+    /// Type erased base of all batch scripts, see BatchScript
+    class BatchScriptBase {
+        friend class NativeScriptSystem;
+
+    public:
+        BatchScriptBase() = default;
+
+        virtual ~BatchScriptBase() = default;
+
+        BatchScriptBase(const BatchScriptBase &o) = delete;
+
+        BatchScriptBase &operator=(const BatchScriptBase &o) = delete;
+
+        /// This function is called once before the first update.
+        virtual void onStart(ECS & /*ecs*/) {}
+
+    private:
+        virtual void update(ECS &ecs, WorkerPool &workers, float deltaTime) = 0;
+
+    private:
+        bool started = false;
+    };
+
+    /**
+     * Game logic for all entities with the components at once, registered once per scene with Scene::addBatchScript.
+     * Instead of a virtual call per entity the script gets a view over the components of all matching entities every
+     * frame, which it can process in a tight loop or in parallel with ParallelView::each. Const components are only
+     * read. Runs on the main thread before the per entity scripts, structural changes MUST be recorded in the command
+     * buffer of the ECS.
+     */
+    template<typename... Component>
+    class BatchScript : public BatchScriptBase {
+    public:
+        /// This function is called once per frame if any entity has the components.
+        virtual void onUpdate(ParallelView<Component...> &entities, float deltaTime) = 0;
+
+    private:
+        void update(ECS &ecs, WorkerPool &workers, float deltaTime) final {
+            auto entities = ecs.parallelView<Component...>(workers);
+            if (!entities.empty())
+                onUpdate(entities, deltaTime);
+        }
+    };
+
+}
@@ -2,18 +2,67 @@
 
 #include "Engine/src/core/Engine.h"
 
+#include <algorithm>
+#include <cassert>
+
+// Script whose onUpdate runs on this thread and whether it runs in parallel to others
+static thread_local const ChaosEngine::NativeScript *updatingScript = nullptr;
+static thread_local bool updatingInParallel = false;
+
+void ChaosEngine::NativeScript::update(float deltaTime, bool parallel) {
+    updatingScript = this;
+    updatingInParallel = parallel;
+    onUpdate(deltaTime);
+    updatingScript = nullptr;
+    updatingInParallel = false;
+}
+
+bool ChaosEngine::NativeScript::isRunningInParallel() {
+    return updatingInParallel;
+}
+
+void ChaosEngine::NativeScript::declare(std::type_index type, std::vector<std::type_index> &list) {
+    if (std::find(list.begin(), list.end(), type) == list.end())
+        list.push_back(type);
+}
+
+void ChaosEngine::NativeScript::checkAccess(std::type_index type, bool write) const {
+    // Only the declared access of the update running on this thread is checked
+    if (updatingScript != this || !accessDeclared)
+        return;
+    const bool writable = std::find(ownWrites.begin(), ownWrites.end(), type) != ownWrites.end();
+    const bool readable = writable || std::find(ownReads.begin(), ownReads.end(), type) != ownReads.end();
+    assert("Script accessed a component it did not declare" && readable);
+    assert("Script wrote a component it only declared as read" && (writable || !write));
+}
+
+void ChaosEngine::NativeScript::startCoroutine(ScriptCoroutine &&coroutine) {
+    assert("Coroutines must be started on the main thread" && !isRunningInParallel());
+    if (lifetime == nullptr)
+        lifetime = std::make_shared<ScriptLifetime>();
+    coroutine.start(Engine::getEngineInstance()->getScriptScheduler(), lifetime);
+}
+
+ChaosEngine::EntityCommandBuffer &ChaosEngine::NativeScript::getCommandBuffer() {
+    return Engine::getEngineInstance()->getCommandBuffer();
+}
+
 bool ChaosEngine::NativeScript::isKeyDown(int keyCode) {
+    assert("Input must only be read on the main thread" && !isRunningInParallel());
     return Engine::getEngineInstance()->getEngineWindow().isKeyDown(keyCode);
 }
 
 bool ChaosEngine::NativeScript::isKeyUp(int keyCode) {
+    assert("Input must only be read on the main thread" && !isRunningInParallel());
     return Engine::getEngineInstance()->getEngineWindow().isKeyUp(keyCode);
 }
 
 bool ChaosEngine::NativeScript::isMouseButtonDown(int button) {
+    assert("Input must only be read on the main thread" && !isRunningInParallel());
     return Engine::getEngineInstance()->getEngineWindow().isMouseButtonDown(button);
 }
 
 bool ChaosEngine::NativeScript::isMouseButtonUp(int button) {
+    assert("Input must only be read on the main thread" && !isRunningInParallel());
     return Engine::getEngineInstance()->getEngineWindow().isMouseButtonUp(button);
 }
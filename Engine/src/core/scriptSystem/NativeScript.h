@@ -1,13 +1,21 @@
 #pragma once
 
 #include "Engine/src/core/Entity.h"
+#include "Engine/src/core/EntityCommandBuffer.h"
+#include "Engine/src/core/scriptSystem/ScriptCoroutine.h"
 #include "Engine/src/core/utils/Logger.h"
 #include <glm/glm.hpp>
 
+#include <vector>
+#include <typeindex>
+#include <type_traits>
+
 class Window;
 
 namespace ChaosEngine {
     class NativeScript {
+        friend class NativeScriptSystem;
+
     public:
         explicit NativeScript(Entity entity) : entity(entity) {}
 
@@ -27,15 +35,17 @@ namespace ChaosEngine {
         /// This function is called once at the initialization of the script.
         virtual void onStart() {}
 
-        /// This function is called once per frame.
+        /// This function is called once per frame, on a worker thread if the script declared its component access.
         virtual void onUpdate(float /*deltaTime*/) {}
 
         // ------------------------------------ Physics Events ---------------------------------------------------------
 
-        /// This function is called if the entity has a **DyanmicRigidBodyComponent** and collides
+        /// This function is called if the entity has a **DyanmicRigidBodyComponent** and collides. If the other entity
+        /// was destroyed meanwhile, it is null but still converts to its id.
         virtual void onCollisionEnter(const Entity& /*other*/) {}
 
-        /// This function is called if the entity has a **DyanmicRigidBodyComponent** and exits a collision
+        /// This function is called if the entity has a **DyanmicRigidBodyComponent** and exits a collision, also if
+        /// the other entity was destroyed. It is null then but still converts to its id.
         virtual void onCollisionExit(const Entity& /*other*/) {}
 
         // ------------------------------------ Additional Events ------------------------------------------------------
@@ -44,6 +54,32 @@ namespace ChaosEngine {
         virtual void onMouseOver() {}
 
     protected:
+        // ------------------------------------ Component Access -------------------------------------------------------
+
+        /**
+         * Declares the components of its own entity which onUpdate uses, const components are only read.
+         * Scripts with declared access run in parallel on the workers, all others run serially on the main thread after
+         * them. onUpdate of a parallel script MUST NOT change the structure of the registry (use the command buffer),
+         * read input, control AudioSources or write components of other entities, its writes are not seen by change
+         * trackers. In debug builds
+         * access to undeclared components through the script helpers asserts. Should be called in the constructor or
+         * onStart.
+         */
+        template <typename... Component>
+        void declareAccess() {
+            accessDeclared = true;
+            (declare(typeid(std::remove_const_t<Component>), std::is_const_v<Component> ? ownReads : ownWrites), ...);
+        }
+
+        /**
+         * Declares components of other entities which onUpdate reads. The script is only run in parallel if no
+         * parallel script writes them.
+         */
+        template <typename... Component>
+        void declareSharedReads() {
+            (declare(typeid(std::remove_const_t<Component>), sharedReads), ...);
+        }
+
         // ------------------------------------ Script Helper Functions ------------------------------------------------
 
         /**
@@ -54,22 +90,39 @@ namespace ChaosEngine {
          */
         template <typename Component, typename... Args>
         inline void setComponent(Args&&... args) {
+            assert("Parallel scripts must record structural changes in the command buffer" && !isRunningInParallel());
             entity.setComponent<Component>(std::forward<Args>(args)...);
         }
 
         /**
-         * Gets the component of type <i>Component</i> of the entity this script belongs to.
+         * Modifies the component of type <i>Component</i> of the entity this script belongs to in place and notifies
+         * change trackers, see Entity::patch.
+         * @tparam Component
+         * @tparam Func
+         * @param func to be called with a reference to the component
+         */
+        template <typename Component, typename... Func>
+        inline decltype(auto) patchComponent(Func&&... func) {
+            assert("Change trackers must only be notified on the main thread" && !isRunningInParallel());
+            return entity.patch<Component>(std::forward<Func>(func)...);
+        }
+
+        /**
+         * Gets the component of type <i>Component</i> of the entity this script belongs to. Only reads the registry, so
+         * parallel scripts may call it on the workers.
          * @tparam Component
          * @return Component
          */
         template <typename... Component>
         [[nodiscard]] decltype(auto) getComponent() {
-            return entity.get<Component...>();
+            (checkAccess<Component>(!std::is_const_v<Component>), ...);
+            return entity.getConcurrent<Component...>();
         }
 
         template <typename... Component>
         [[nodiscard]] decltype(auto) getComponent() const {
-            return entity.get<Component...>();
+            (checkAccess<Component>(false), ...);
+            return entity.getConcurrent<const Component...>();
         }
 
         /**
@@ -79,9 +132,37 @@ namespace ChaosEngine {
          */
         template <typename... Component>
         [[nodiscard]] decltype(auto) hasComponent() {
+            (checkAccess<Component>(false), ...);
             return entity.has<Component...>();
         }
 
+        /**
+         * Creating or destroying entities and adding or removing components of other entities MUST be recorded here,
+         * scripts run while systems iterate over the registry. The changes are applied at the next sync point.
+         */
+        static EntityCommandBuffer &getCommandBuffer();
+
+        // ------------------------------------ Coroutines -------------------------------------------------------------
+
+        /**
+         * Runs the coroutine until it suspends for the first time, the ScriptScheduler resumes it on the main thread
+         * from then on. Coroutines are not resumed anymore once the script is destroyed.
+         * Example: `startCoroutine(spawnWaves());` with `ScriptCoroutine spawnWaves() { co_await wait(2.0f); ... }`
+         */
+        void startCoroutine(ScriptCoroutine &&coroutine);
+
+        static NextFrameAwaitable nextFrame() { return {}; }
+
+        static DelayAwaitable wait(float seconds) { return {seconds}; }
+
+        static ConditionAwaitable waitUntil(std::function<bool()> condition) {
+            return ConditionAwaitable(std::move(condition));
+        }
+
+        /// Waits for an asynchronously loaded value, e.g. an asset, co_await returns the value
+        template <typename T>
+        static FutureAwaitable<T> waitFor(std::shared_future<T> future) { return FutureAwaitable<T>(std::move(future)); }
+
         // ------------------------------------ Input Helpers ----------------------------------------------------------
     protected:
         static bool isKeyDown(int keyCode);
@@ -92,7 +173,34 @@ namespace ChaosEngine {
 
         static bool isMouseButtonUp(int button);
 
+    public:
+        /// True while the calling thread runs the onUpdate of a parallel script
+        static bool isRunningInParallel();
+
+    private:
+        /// Runs onUpdate, accesses of scripts with declared access are checked meanwhile
+        void update(float deltaTime, bool parallel);
+
+        void declare(std::type_index type, std::vector<std::type_index> &list);
+
+        template <typename Component>
+        void checkAccess(bool write) const {
+#ifndef NDEBUG
+            checkAccess(typeid(std::remove_const_t<Component>), write);
+#endif
+        }
+
+        void checkAccess(std::type_index type, bool write) const;
+
     protected:
         Entity entity;
+
+    private:
+        bool accessDeclared = false;
+        std::vector<std::type_index> ownReads{};
+        std::vector<std::type_index> ownWrites{};
+        std::vector<std::type_index> sharedReads{};
+        // Created with the first coroutine
+        std::shared_ptr<ScriptLifetime> lifetime = nullptr;
     };
 }
@@ -1,11 +1,16 @@
 #include "NativeScriptSystem.h"
-#include "Engine/src/core/Ecs.h"
+#include "Engine/src/core/Scene.h"
 #include "Engine/src/core/Components.h"
+#include "Engine/src/core/utils/WorkerPool.h"
+
+#include <algorithm>
+#include <unordered_set>
 
 using namespace ChaosEngine;
 
-void NativeScriptSystem::init(ChaosEngine::ECS &ecs) {
-    auto scripts = ecs.getRegistry().view<NativeScriptComponent>();
+void NativeScriptSystem::init(Scene &scene) {
+    startBatchScripts(scene);
+    auto scripts = scene.ecs.getRegistry().view<NativeScriptComponent>();
 
     for (auto&&[entity, scriptComponent]: scripts.each()) {
         if (scriptComponent.script == nullptr || !scriptComponent.active)
@@ -18,9 +23,16 @@ void NativeScriptSystem::init(ChaosEngine::ECS &ecs) {
 
 }
 
-void NativeScriptSystem::update(ChaosEngine::ECS &ecs, float deltaTime) {
-    auto scripts = ecs.getRegistry().view<NativeScriptComponent>();
+void NativeScriptSystem::update(Scene &scene, float deltaTime) {
+    startBatchScripts(scene);
+    for (auto &script: scene.batchScripts) {
+        script->update(scene.ecs, workers, deltaTime);
+    }
+
+    auto scripts = scene.ecs.getRegistry().view<NativeScriptComponent>();
 
+    parallelScripts.clear();
+    serialScripts.clear();
     for (auto&&[entity, scriptComponent]: scripts.each()) {
         if (scriptComponent.script == nullptr || !scriptComponent.active)
             continue;
@@ -28,7 +40,45 @@ void NativeScriptSystem::update(ChaosEngine::ECS &ecs, float deltaTime) {
             scriptComponent.script->onStart();
             scriptComponent.initialized = true;
         }
-        scriptComponent.script->onUpdate(deltaTime);
+        auto *script = scriptComponent.script.get();
+        (script->accessDeclared ? parallelScripts : serialScripts).push_back(script);
+    }
+    resolveConflicts(parallelScripts, serialScripts);
+
+    workers.parallelFor(parallelScripts.size(), scriptsPerChunk, [this, deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            parallelScripts[i]->update(deltaTime, true);
+        }
+    });
+    for (auto *script: serialScripts) {
+        script->update(deltaTime, false);
+    }
+
+    scheduler.update(deltaTime);
+}
+
+void NativeScriptSystem::startBatchScripts(Scene &scene) {
+    for (auto &script: scene.batchScripts) {
+        if (!script->started) {
+            script->onStart(scene.ecs);
+            script->started = true;
+        }
+    }
+}
+
+void NativeScriptSystem::resolveConflicts(std::vector<NativeScript *> &parallel,
+                                          std::vector<NativeScript *> &serial) {
+    std::unordered_set<std::type_index> written;
+    for (const auto *script: parallel) {
+        written.insert(script->ownWrites.begin(), script->ownWrites.end());
     }
 
+    // Scripts writing their own components never conflict, every entity has one script
+    const auto conflicting = std::stable_partition(
+            parallel.begin(), parallel.end(), [&written](const NativeScript *script) {
+                return std::none_of(script->sharedReads.begin(), script->sharedReads.end(),
+                                    [&written](std::type_index type) { return written.contains(type); });
+            });
+    serial.insert(serial.end(), conflicting, parallel.end());
+    parallel.erase(conflicting, parallel.end());
 }
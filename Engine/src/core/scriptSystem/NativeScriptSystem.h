@@ -1,11 +1,28 @@
 #pragma once
 
-namespace ChaosEngine {
-    class ECS;
+#include <vector>
+#include <cstddef>
+
+#include "ScriptScheduler.h"
 
+namespace ChaosEngine {
+    class Scene;
+    class NativeScript;
+    class WorkerPool;
+
+    /**
+     * Runs the batch scripts of the scene and then the scripts of all entities.
+     * Scripts which declared their component access run in parallel on the workers, unless they read components of
+     * other entities which parallel scripts write. All other scripts run serially on the main thread afterwards,
+     * followed by the script coroutines which are due.
+     */
     class NativeScriptSystem {
     public:
-        NativeScriptSystem() = default;
+        /// Scripts are expensive compared to components, so chunks are small
+        static constexpr size_t scriptsPerChunk = 8;
+
+    public:
+        explicit NativeScriptSystem(WorkerPool &workers) : workers(workers) {}
 
         ~NativeScriptSystem() = default;
 
@@ -17,11 +34,26 @@ namespace ChaosEngine {
 
         NativeScriptSystem &operator=(NativeScriptSystem &&o) = delete;
 
-        void init(ECS &ecs);
+        void init(Scene &scene);
 
-        void update(ECS &ecs, float deltaTime);
+        void update(Scene &scene, float deltaTime);
+
+        ScriptScheduler &getScheduler() { return scheduler; }
+
+        /**
+         * Moves the parallel scripts which read components of other entities that parallel scripts write to the end of
+         * the serial ones, both keep their order.
+         */
+        static void resolveConflicts(std::vector<NativeScript *> &parallel, std::vector<NativeScript *> &serial);
+
+    private:
+        void startBatchScripts(Scene &scene);
 
     private:
+        WorkerPool &workers;
+        ScriptScheduler scheduler;
+        std::vector<NativeScript *> parallelScripts{};
+        std::vector<NativeScript *> serialScripts{};
     };
 
 }
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <coroutine>
+#include <functional>
+#include <future>
+#include <memory>
+#include <chrono>
+#include <exception>
+#include <utility>
+#include <cassert>
+
+namespace ChaosEngine {
+    class ScriptScheduler;
+
+    /// Lives as long as the script which started a coroutine, coroutines of dead scripts are never resumed
+    struct ScriptLifetime {
+    };
+
+    /**
+     * Coroutine of a script, started with NativeScript::startCoroutine.
+     * Once started the ScriptScheduler owns the suspended coroutine and resumes it on the main thread when the awaited
+     * frame, delay, condition or future is due. A finished coroutine destroys itself.
+     */
+    class ScriptCoroutine {
+    public:
+        struct promise_type {
+            ScriptScheduler *scheduler = nullptr;
+            std::weak_ptr<ScriptLifetime> owner{};
+
+            ScriptCoroutine get_return_object() {
+                return ScriptCoroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            // Started explicitly, once the scheduler and owner are known
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            std::suspend_never final_suspend() noexcept { return {}; }
+
+            void return_void() {}
+
+            void unhandled_exception() { throw; }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+    public:
+        ~ScriptCoroutine() {
+            if (handle)
+                handle.destroy();
+        }
+
+        ScriptCoroutine(const ScriptCoroutine &o) = delete;
+
+        ScriptCoroutine &operator=(const ScriptCoroutine &o) = delete;
+
+        ScriptCoroutine(ScriptCoroutine &&o) noexcept: handle(std::exchange(o.handle, nullptr)) {}
+
+        ScriptCoroutine &operator=(ScriptCoroutine &&o) noexcept {
+            if (this == &o)
+                return *this;
+            if (handle)
+                handle.destroy();
+            handle = std::exchange(o.handle, nullptr);
+            return *this;
+        }
+
+        /// Hands the coroutine over to the scheduler and runs it until it suspends for the first time
+        void start(ScriptScheduler &scheduler, std::weak_ptr<ScriptLifetime> owner) {
+            assert("Coroutine was already started" && handle);
+            handle.promise().scheduler = &scheduler;
+            handle.promise().owner = std::move(owner);
+            std::exchange(handle, nullptr).resume();
+        }
+
+    private:
+        explicit ScriptCoroutine(Handle handle) : handle(handle) {}
+
+    private:
+        Handle handle;
+    };
+
+    // ------------------------------------ Awaitables -----------------------------------------------------------------
+    // Awaitables with members that are not trivially destructible need constructors, GCC 12 destroys temporary
+    // aggregates in co_await expressions twice.
+
+    /// Resumes the coroutine in the next frame
+    struct NextFrameAwaitable {
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(ScriptCoroutine::Handle handle) const;
+
+        void await_resume() const noexcept {}
+    };
+
+    /// Resumes the coroutine once the delay in seconds passed, in the first frame after it
+    struct DelayAwaitable {
+        float seconds;
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(ScriptCoroutine::Handle handle) const;
+
+        void await_resume() const noexcept {}
+    };
+
+    /// Resumes the coroutine in the first frame the condition holds, the condition is checked once per frame
+    struct ConditionAwaitable {
+        explicit ConditionAwaitable(std::function<bool()> condition) : condition(std::move(condition)) {}
+
+        bool await_ready() const { return condition(); }
+
+        void await_suspend(ScriptCoroutine::Handle handle);
+
+        void await_resume() const noexcept {}
+
+    private:
+        std::function<bool()> condition;
+    };
+
+    /// Resumes the coroutine in the first frame the future is ready and returns its value
+    template<typename T>
+    struct FutureAwaitable {
+        explicit FutureAwaitable(std::shared_future<T> future) : future(std::move(future)) {}
+
+        bool await_ready() const { return isReady(future); }
+
+        void await_suspend(ScriptCoroutine::Handle handle) {
+            ConditionAwaitable([future = future]() { return isReady(future); }).await_suspend(handle);
+        }
+
+        decltype(auto) await_resume() const { return future.get(); }
+
+    private:
+        std::shared_future<T> future;
+
+        static bool isReady(const std::shared_future<T> &future) {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+    };
+
+}
@@ -0,0 +1,112 @@
+#include "ScriptScheduler.h"
+
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+
+using namespace ChaosEngine;
+
+// ---- Awaitables ----
+
+void NextFrameAwaitable::await_suspend(ScriptCoroutine::Handle handle) const {
+    handle.promise().scheduler->scheduleNextFrame(handle);
+}
+
+void DelayAwaitable::await_suspend(ScriptCoroutine::Handle handle) const {
+    handle.promise().scheduler->scheduleDelay(handle, seconds);
+}
+
+void ConditionAwaitable::await_suspend(ScriptCoroutine::Handle handle) {
+    handle.promise().scheduler->scheduleCondition(handle, std::move(condition));
+}
+
+// ---- Scheduler ----
+
+void ScriptScheduler::scheduleNextFrame(ScriptCoroutine::Handle handle) {
+    nextFrame.push_back(handle);
+    ++suspendedCount;
+}
+
+void ScriptScheduler::scheduleDelay(ScriptCoroutine::Handle handle, float seconds) {
+    // At least one tick, so the coroutine is not resumed in the same update
+    const auto ticks = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(std::max(seconds, 0.0f) / tickDuration)));
+    const auto slot = static_cast<uint32_t>((currentTick + ticks) % slotCount);
+    wheel[slot].push_back(Timer{handle, static_cast<uint32_t>((ticks - 1) / slotCount)});
+    ++suspendedCount;
+}
+
+void ScriptScheduler::scheduleCondition(ScriptCoroutine::Handle handle, std::function<bool()> &&condition) {
+    conditions.push_back(Condition{handle, std::move(condition)});
+    ++suspendedCount;
+}
+
+void ScriptScheduler::update(float deltaTime) {
+    dueFrames.swap(nextFrame);
+    for (auto handle: dueFrames) {
+        resume(handle);
+    }
+    dueFrames.clear();
+
+    pendingTime += deltaTime;
+    while (pendingTime >= tickDuration) {
+        pendingTime -= tickDuration;
+        advanceTick();
+    }
+
+    dueConditions.swap(conditions);
+    for (auto &waiting: dueConditions) {
+        // The condition may refer to the script, so it is only checked while the script exists
+        if (waiting.handle.promise().owner.expired() || waiting.condition()) {
+            resume(waiting.handle);
+        } else {
+            conditions.push_back(std::move(waiting));
+        }
+    }
+    dueConditions.clear();
+}
+
+void ScriptScheduler::advanceTick() {
+    ++currentTick;
+    auto &slot = wheel[currentTick % slotCount];
+    if (slot.empty())
+        return;
+
+    dueTimers.swap(slot);
+    for (auto &timer: dueTimers) {
+        if (timer.rounds > 0) {
+            --timer.rounds;
+            slot.push_back(timer);
+        } else {
+            resume(timer.handle);
+        }
+    }
+    dueTimers.clear();
+}
+
+void ScriptScheduler::resume(ScriptCoroutine::Handle handle) {
+    assert("Scheduler lost track of a coroutine" && suspendedCount > 0);
+    --suspendedCount;
+    if (handle.promise().owner.expired()) {
+        handle.destroy();
+    } else {
+        handle.resume();
+    }
+}
+
+void ScriptScheduler::clear() {
+    for (auto &slot: wheel) {
+        for (auto &timer: slot) {
+            timer.handle.destroy();
+        }
+        slot.clear();
+    }
+    for (auto handle: nextFrame) {
+        handle.destroy();
+    }
+    nextFrame.clear();
+    for (auto &waiting: conditions) {
+        waiting.handle.destroy();
+    }
+    conditions.clear();
+    suspendedCount = 0;
+}
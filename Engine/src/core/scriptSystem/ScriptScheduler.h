@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+#include "ScriptCoroutine.h"
+
+namespace ChaosEngine {
+
+    /**
+     * Resumes suspended script coroutines on the main thread.
+     * Delays are kept in a hashed timer wheel: every tick only the coroutines in the slot of the tick are visited, so
+     * waiting coroutines cost nothing per frame. Delays longer than one revolution of the wheel are visited once per
+     * revolution. Conditions are checked every frame.
+     * The scheduler owns the suspended coroutines, those of scripts which no longer exist are destroyed instead of
+     * resumed.
+     */
+    class ScriptScheduler {
+    public:
+        static constexpr uint32_t slotCount = 256;
+        /// Resolution of delays in seconds, one revolution of the wheel covers 2.56 seconds
+        static constexpr float tickDuration = 0.01f;
+
+    public:
+        ScriptScheduler() = default;
+
+        ~ScriptScheduler() { clear(); }
+
+        ScriptScheduler(const ScriptScheduler &o) = delete;
+
+        ScriptScheduler &operator=(const ScriptScheduler &o) = delete;
+
+        void scheduleNextFrame(ScriptCoroutine::Handle handle);
+
+        void scheduleDelay(ScriptCoroutine::Handle handle, float seconds);
+
+        void scheduleCondition(ScriptCoroutine::Handle handle, std::function<bool()> &&condition);
+
+        /// Advances the time and resumes all due coroutines, coroutines suspending again are resumed at the earliest
+        /// in the next update
+        void update(float deltaTime);
+
+        /// Destroys all suspended coroutines, e.g. when the scene changes
+        void clear();
+
+        [[nodiscard]] size_t size() const { return suspendedCount; }
+
+    private:
+        struct Timer {
+            ScriptCoroutine::Handle handle;
+            uint32_t rounds; // Remaining revolutions of the wheel
+        };
+
+        struct Condition {
+            ScriptCoroutine::Handle handle;
+            std::function<bool()> condition;
+        };
+
+        void resume(ScriptCoroutine::Handle handle);
+
+        void advanceTick();
+
+    private:
+        std::array<std::vector<Timer>, slotCount> wheel{};
+        uint64_t currentTick = 0;
+        float pendingTime = 0.0f; // Time which did not yet fill a whole tick
+        std::vector<ScriptCoroutine::Handle> nextFrame{};
+        std::vector<Condition> conditions{};
+        size_t suspendedCount = 0;
+        // Reused to process a batch while newly suspended coroutines are added to the original container
+        std::vector<Timer> dueTimers{};
+        std::vector<ScriptCoroutine::Handle> dueFrames{};
+        std::vector<Condition> dueConditions{};
+    };
+
+}
@@ -46,8 +46,6 @@ void UISystem::init(ECS &/*ecs*/) {
 }
 
 void UISystem::update(ECS &ecs) {
-    auto scripts = ecs.getRegistry().view<const Transform, const UIComponent>();
-
     // Handle mouse input and dispatch events for UI Component
     auto mouse = window.getAbsoluteMousePos();
     auto viewportExtent = window.getGameWindowExtent();
@@ -59,19 +57,32 @@ void UISystem::update(ECS &ecs) {
     // Relative mouse position in viewport
     glm::vec2 mousePos{mouse.x - viewportExtent.first.x, mouse.y - viewportExtent.first.y};
 //    LOG_DEBUG("Mouse position {}x{}", mousePos.x, mousePos.y);
-    for (const auto &[entity, transform, ui]: scripts.each()) {
-        if (!ui.active)
-            continue;
-        bool isMouseOver = ((transform.rotation + ui.offsetRotation) == glm::vec3(0, 0, 0)) ?
-                           pointInAxisAlignedBox(transform, ui, mousePos) : pointInRectangle(transform, ui, mousePos);
-        if (isMouseOver) {
-            Entity entityH = ecs.getEntity(entity);
-            if (entityH.has<NativeScriptComponent>()) {
-                auto &script = entityH.get<NativeScriptComponent>();
-                if (script.active) {
-                    // LOG_DEBUG("Collision {:x}", entity);
-                    script.script->onMouseOver();
-                }
+    // Hit testing runs on the workers, the scripts are notified on the calling thread once the view is released
+    hovered.clear();
+    {
+        auto elements = ecs.parallelView<const Transform, const UIComponent>(workers);
+        mouseOver.resize(elements.size());
+        elements.chunks([&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const auto [transform, ui] = elements.get(i);
+                mouseOver[i] = ui.active && (((transform.rotation + ui.offsetRotation) == glm::vec3(0, 0, 0)) ?
+                                             pointInAxisAlignedBox(transform, ui, mousePos) :
+                                             pointInRectangle(transform, ui, mousePos));
+            }
+        });
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (mouseOver[i])
+                hovered.push_back(elements.entity(i));
+        }
+    }
+
+    for (auto entity: hovered) {
+        Entity entityH = ecs.getEntity(entity);
+        if (entityH.has<NativeScriptComponent>()) {
+            auto &script = entityH.get<NativeScriptComponent>();
+            if (script.active) {
+                // LOG_DEBUG("Collision {:x}", entity);
+                script.script->onMouseOver();
             }
         }
     }
@@ -2,13 +2,16 @@
 
 #include "Engine/src/core/renderSystem/RenderingSystem.h"
 #include "Engine/src/core/assets/Font.h"
+#include "Engine/src/core/utils/WorkerPool.h"
+
+#include <vector>
 
 namespace ChaosEngine {
     class UISystem {
 
     public:
-        explicit UISystem(ChaosEngine::RenderingSystem &renderingSystem, Window &window)
-                : renderingSystem(renderingSystem), window(window) {}
+        UISystem(ChaosEngine::RenderingSystem &renderingSystem, Window &window, WorkerPool &workers)
+                : renderingSystem(renderingSystem), window(window), workers(workers) {}
 
         void init(ECS &ecs);
 
@@ -17,5 +20,9 @@ namespace ChaosEngine {
     private:
         ChaosEngine::RenderingSystem &renderingSystem;
         Window &window;
+        WorkerPool &workers;
+        // Reused every update
+        std::vector<uint8_t> mouseOver;
+        std::vector<entt::entity> hovered;
     };
 }
@@ -12,4 +12,34 @@ namespace GLMCustomExtension {
         };
     }
 
+    /**
+     * 2D affine transform, a 2x2 linear part and a translation with the depth of the sprite.
+     * Half the size of a mat4 and laid out as the model push constant of the 2D shaders.
+     */
+    struct Affine2D {
+        glm::vec4 linear{1, 0, 0, 1}; // Column major 2x2 matrix
+        glm::vec4 translation{0, 0, 0, 0}; // x, y, depth, unused
+    };
+
+    /// Applies the child transform first, the depths add up
+    inline Affine2D combine(const Affine2D &parent, const Affine2D &child) {
+        const glm::mat2 linear = glm::mat2(parent.linear.x, parent.linear.y, parent.linear.z, parent.linear.w);
+        const glm::vec2 column0 = linear * glm::vec2(child.linear.x, child.linear.y);
+        const glm::vec2 column1 = linear * glm::vec2(child.linear.z, child.linear.w);
+        const glm::vec2 translation = linear * glm::vec2(child.translation) + glm::vec2(parent.translation);
+        return Affine2D{
+                glm::vec4(column0, column1),
+                glm::vec4(translation, parent.translation.z + child.translation.z, 0)
+        };
+    }
+
+    inline glm::mat4 toMat4(const Affine2D &transform) {
+        return glm::mat4{
+                transform.linear.x, transform.linear.y, 0, 0,
+                transform.linear.z, transform.linear.w, 0, 0,
+                0, 0, 1, 0,
+                transform.translation.x, transform.translation.y, transform.translation.z, 1
+        };
+    }
+
 }
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+namespace ChaosEngine {
+
+    /**
+     * Bounded lock-free queue between exactly one producer thread and exactly one consumer thread.
+     * The capacity is rounded up to a power of two, one slot always stays empty to tell a full queue from an empty one.
+     */
+    template<typename T>
+    class SPSCQueue {
+    public:
+        explicit SPSCQueue(size_t minCapacity) : slots(roundUpToPowerOfTwo(minCapacity + 1)), mask(slots.size() - 1) {}
+
+        ~SPSCQueue() = default;
+
+        SPSCQueue(const SPSCQueue &o) = delete;
+
+        SPSCQueue &operator=(const SPSCQueue &o) = delete;
+
+        /// Producer only, returns false and leaves the value untouched if the queue is full
+        bool tryPush(T &&value) {
+            const size_t currentTail = tail.load(std::memory_order_relaxed);
+            const size_t nextTail = (currentTail + 1) & mask;
+            if (nextTail == head.load(std::memory_order_acquire))
+                return false;
+            slots[currentTail] = std::move(value);
+            tail.store(nextTail, std::memory_order_release);
+            return true;
+        }
+
+        /// Consumer only, returns false if the queue is empty
+        bool tryPop(T &value) {
+            const size_t currentHead = head.load(std::memory_order_relaxed);
+            if (currentHead == tail.load(std::memory_order_acquire))
+                return false;
+            value = std::move(slots[currentHead]);
+            slots[currentHead] = T{}; // Release resources held by the moved-from slot
+            head.store((currentHead + 1) & mask, std::memory_order_release);
+            return true;
+        }
+
+        [[nodiscard]] size_t capacity() const { return slots.size() - 1; }
+
+    private:
+        static size_t roundUpToPowerOfTwo(size_t value) {
+            size_t result = 1;
+            while (result < value)
+                result <<= 1;
+            return result;
+        }
+
+    private:
+        std::vector<T> slots;
+        const size_t mask;
+        alignas(64) std::atomic<size_t> head{0}; // Next slot to pop, written by the consumer
+        alignas(64) std::atomic<size_t> tail{0}; // Next slot to push, written by the producer
+    };
+
+}
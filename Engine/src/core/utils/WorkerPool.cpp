@@ -0,0 +1,100 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace ChaosEngine;
+
+uint32_t WorkerPool::DefaultWorkerCount() {
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+}
+
+WorkerPool::WorkerPool(uint32_t workerCount) {
+    workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&WorkerPool::run, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(mutex);
+        stopRequested = true;
+    }
+    wake.notify_all();
+    for (auto &worker: workers) {
+        worker.join();
+    }
+}
+
+void WorkerPool::parallelFor(size_t count, size_t chunkSize, const Range &function) {
+    if (count == 0)
+        return;
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    const size_t chunks = (count + chunkSize - 1) / chunkSize;
+    if (workers.empty() || chunks == 1) {
+        function(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        assert("parallelFor MUST not be nested or called concurrently" && job == nullptr);
+        job = &function;
+        jobCount = count;
+        jobChunkSize = chunkSize;
+        jobChunks = chunks;
+        nextChunk.store(0, std::memory_order_relaxed);
+        pendingChunks.store(chunks, std::memory_order_relaxed);
+        ++jobGeneration;
+        ++participants;
+    }
+    wake.notify_all();
+
+    work();
+
+    std::unique_lock lock(mutex);
+    --participants;
+    // Workers which woke up late must not pick up the next job with the state of this one
+    done.wait(lock, [this] { return pendingChunks.load(std::memory_order_acquire) == 0 && participants == 0; });
+    job = nullptr;
+}
+
+void WorkerPool::run() {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock lock(mutex);
+            wake.wait(lock, [&] { return stopRequested || jobGeneration != seenGeneration; });
+            if (stopRequested)
+                return;
+            seenGeneration = jobGeneration;
+            if (job == nullptr)
+                continue;
+            ++participants;
+        }
+
+        work();
+
+        {
+            std::lock_guard lock(mutex);
+            --participants;
+        }
+        done.notify_all();
+    }
+}
+
+void WorkerPool::work() {
+    while (true) {
+        const size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= jobChunks)
+            return;
+        const size_t begin = chunk * jobChunkSize;
+        (*job)(begin, std::min(begin + jobChunkSize, jobCount));
+        if (pendingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard lock(mutex);
+            done.notify_all();
+        }
+    }
+}
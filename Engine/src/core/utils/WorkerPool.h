@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+
+namespace ChaosEngine {
+
+    /**
+     * Persistent worker threads for data parallel loops of the engine systems.
+     * The calling thread takes part in every loop, so a pool without workers runs everything serially.
+     */
+    class WorkerPool {
+    public:
+        using Range = std::function<void(size_t begin, size_t end)>;
+
+    public:
+        /// Defaults to one worker less than the hardware threads, the calling thread is the remaining one
+        explicit WorkerPool(uint32_t workerCount = DefaultWorkerCount());
+
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool &o) = delete;
+
+        WorkerPool &operator=(const WorkerPool &o) = delete;
+
+        /**
+         * Splits [0, count) into chunks and calls the function for every chunk on the workers and the calling thread.
+         * Returns once all chunks are processed.
+         * @note MUST only be called from one thread at a time and not from within a chunk
+         */
+        void parallelFor(size_t count, size_t chunkSize, const Range &function);
+
+        [[nodiscard]] uint32_t getWorkerCount() const { return static_cast<uint32_t>(workers.size()); }
+
+        static uint32_t DefaultWorkerCount();
+
+    private:
+        void run();
+
+        /// Processes chunks of the current job until none are left
+        void work();
+
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        bool stopRequested = false;
+
+        // Current job, only changed under the mutex while no worker takes part in it
+        const Range *job = nullptr;
+        size_t jobCount = 0;
+        size_t jobChunkSize = 0;
+        size_t jobChunks = 0;
+        uint64_t jobGeneration = 0;
+        uint32_t participants = 0;
+        std::atomic<size_t> nextChunk = 0;
+        std::atomic<size_t> pendingChunks = 0;
+    };
+
+}
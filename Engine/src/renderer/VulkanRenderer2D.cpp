@@ -185,7 +185,7 @@ void VulkanRenderer2D::flush() {
     }
 }
 
-void VulkanRenderer2D::draw(const glm::mat4& modelMat, const RenderComponent& renderComponent) {
+void VulkanRenderer2D::draw(const GLMCustomExtension::Affine2D& modelMat, const RenderComponent& renderComponent) {
     const auto& mesh = dynamic_cast<const VulkanRenderMesh&>(*(renderComponent.mesh));
     const auto& material = dynamic_cast<const VulkanMaterialInstance&>(*(renderComponent.materialInstance));
     spriteRenderingPass.drawSprite(mesh, modelMat, material);
@@ -194,19 +194,21 @@ void VulkanRenderer2D::draw(const glm::mat4& modelMat, const RenderComponent& re
 void
 VulkanRenderer2D::drawText(const Renderer::Buffer& vertexBuffer, const Renderer::Buffer& indexBuffer,
                            uint32_t indexCount, uint32_t indexOffset,
-                           const glm::mat4& modelMat, const Renderer::MaterialInstance& materialInstance) {
+                           const GLMCustomExtension::Affine2D& modelMat, const Renderer::MaterialInstance& materialInstance) {
     const auto& vulkanVBuffer = dynamic_cast<const VulkanBuffer&>(vertexBuffer);
     const auto& vulkanIBuffer = dynamic_cast<const VulkanBuffer&>(indexBuffer);
     const auto& vulkanMaterialI = dynamic_cast<const VulkanMaterialInstance&>(materialInstance);
-    textRenderingPass.drawUI(vulkanVBuffer, vulkanIBuffer, indexCount, indexOffset, modelMat, vulkanMaterialI);
+    textRenderingPass.drawUI(vulkanVBuffer, vulkanIBuffer, IndexFormat::UInt32, indexCount, indexOffset, modelMat,
+                             vulkanMaterialI);
 }
 
-void VulkanRenderer2D::drawUI(const glm::mat4& modelMat, const Renderer::RenderMesh& mesh,
+void VulkanRenderer2D::drawUI(const GLMCustomExtension::Affine2D& modelMat, const Renderer::RenderMesh& mesh,
                               const Renderer::MaterialInstance& material) {
     const auto* vulkanVBuffer = dynamic_cast<const VulkanBuffer*>(mesh.getVertexBuffer());
     const auto* vulkanIBuffer = dynamic_cast<const VulkanBuffer*>(mesh.getIndexBuffer());
     const auto& vulkanMaterialI = dynamic_cast<const VulkanMaterialInstance&>(material);
-    uiRenderingPass.drawUI(*vulkanVBuffer, *vulkanIBuffer, mesh.getIndexCount(), 0, modelMat, vulkanMaterialI);
+    uiRenderingPass.drawUI(*vulkanVBuffer, *vulkanIBuffer, mesh.getIndexFormat(), mesh.getIndexCount(), 0, modelMat,
+                           vulkanMaterialI);
 }
 
 void VulkanRenderer2D::drawSceneDebug(const glm::mat4& viewMat, const CameraComponent& camera,
@@ -88,16 +88,16 @@ public:
     void requestViewportResize(const glm::vec2 &viewportSize) override;
 
     // Rendering commands
-    /// Render an object with its material and model matrix
-    void draw(const glm::mat4 &modelMat, const RenderComponent &renderComponent) override;
+    /// Render an object with its material and 2D model matrix
+    void draw(const GLMCustomExtension::Affine2D &modelMat, const RenderComponent &renderComponent) override;
 
     /// Render an indexed vertex buffer with its material
     void drawText(const Renderer::Buffer &vertexBuffer, const Renderer::Buffer &indexBuffer,
                   uint32_t indexCount, uint32_t indexOffset,
-                  const glm::mat4 &modelMat, const Renderer::MaterialInstance &materialInstance) override;
+                  const GLMCustomExtension::Affine2D &modelMat, const Renderer::MaterialInstance &materialInstance) override;
 
-    /// Render a mesh with a material and model matrix
-    void drawUI(const glm::mat4 &viewMatrix, const Renderer::RenderMesh &mesh,
+    /// Render a mesh with a material and 2D model matrix
+    void drawUI(const GLMCustomExtension::Affine2D &modelMat, const Renderer::RenderMesh &mesh,
                 const Renderer::MaterialInstance &material) override;
 
 
@@ -54,6 +54,11 @@ namespace Renderer {
          */
         virtual void tickFrame() = 0;
 
+        /**
+         * Number of frames ticked since the creation of the context.
+         */
+        [[nodiscard]] virtual uint32_t getFrameCounter() const = 0;
+
         /**
          * Wait until the graphics process has finished all its async tasks.
          */
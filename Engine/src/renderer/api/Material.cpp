@@ -19,7 +19,7 @@ std::vector<ShaderBindings> Material::StandardOpaqueSet0 = std::vector<ShaderBin
 
 std::vector<ShaderPushConstantLayout> Material::StandardOpaquePushConstants = std::vector<ShaderPushConstantLayout>(
         {
-                ShaderPushConstantLayout{.type = ShaderValueType::Mat4, .stage=ShaderStage::Vertex, .offset=0, .name ="modelMat"},
+                ShaderPushConstantLayout{.type = ShaderValueType::Affine2D, .stage=ShaderStage::Vertex, .offset=0, .name ="model"},
         });
 
 // ------------------------------------ Class Members ------------------------------------------------------------------
@@ -3,6 +3,7 @@
 #include "Texture.h"
 
 #include <glm/glm.hpp>
+#include "Engine/src/core/utils/GLMCustomExtension.h"
 
 #include <string>
 #include <utility>
@@ -14,7 +15,9 @@
 namespace Renderer {
 // ----------------------------- Vertex Input Configuration ------------------------------------------------------------
     enum class VertexFormat {
-        R_FLOAT, RG_FLOAT, RGB_FLOAT, RGBA_FLOAT
+        R_FLOAT, RG_FLOAT, RGB_FLOAT, RGBA_FLOAT,
+        RG_HALF, // Read as vec2
+        RGBA_UNORM8 // Read as vec4 in [0, 1]
     };
     enum class InputRate {
         Vertex, Instance
@@ -64,7 +67,7 @@ namespace Renderer {
         UniformBuffer, TextureSampler
     };
     enum class ShaderValueType {
-        Vec4, Mat4
+        Vec4, Mat4, Affine2D
     };
 
     inline uint32_t getSizeOfShaderValueType(ShaderValueType type) {
@@ -73,6 +76,8 @@ namespace Renderer {
                 return sizeof(glm::vec4);
             case ShaderValueType::Mat4:
                 return sizeof(glm::mat4);
+            case ShaderValueType::Affine2D:
+                return sizeof(GLMCustomExtension::Affine2D);
             default:
                 assert("Unknown Shader Value Type!" && false);
                 return 0;
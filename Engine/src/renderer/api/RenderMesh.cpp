@@ -23,3 +23,22 @@ Renderer::RenderMesh::Create(std::unique_ptr<Buffer> &&vertexBuffer, std::unique
     }
     return nullptr;
 }
+
+std::unique_ptr<RenderMesh>
+Renderer::RenderMesh::Create(std::unique_ptr<Buffer> &&vertexBuffer, std::unique_ptr<Buffer> &&indexBuffer,
+                             size_t indexCount, IndexFormat indexFormat, std::vector<MeshLOD> &&lods,
+                             float boundingRadius) {
+    assert("A mesh needs at least one LOD!" && !lods.empty());
+    switch (GraphicsContext::currentAPI) {
+        case GraphicsAPI::Vulkan: {
+            auto &vBuffer = dynamic_cast<VulkanBuffer &>(*vertexBuffer);
+            auto &iBuffer = dynamic_cast<VulkanBuffer &>(*indexBuffer);
+            return std::make_unique<VulkanRenderMesh>(std::move(vBuffer), std::move(iBuffer),
+                                                      static_cast<uint32_t>(indexCount), indexFormat,
+                                                      std::move(lods), boundingRadius);
+        }
+        default:
+            assert("Invalid Graphics API" && false);
+    }
+    return nullptr;
+}
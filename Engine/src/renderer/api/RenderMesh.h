@@ -3,22 +3,59 @@
 #include <string>
 
 #include "Engine/src/renderer/api/Buffer.h"
+#include "Engine/src/core/assets/Mesh.h"
 
 #include <memory>
+#include <vector>
 
 namespace Renderer {
 
     class RenderMesh {
     public:
-        explicit RenderMesh(uint32_t indexCount) : indexCount(indexCount), indexed(false) {}
+        explicit RenderMesh(uint32_t indexCount)
+                : indexCount(indexCount), indexed(false), indexFormat(IndexFormat::UInt32),
+                  lods{MeshLOD{0, indexCount, 0.0f}}, boundingRadius(0.0f) {}
+
+        RenderMesh(uint32_t indexCount, IndexFormat indexFormat, std::vector<MeshLOD> &&lods, float boundingRadius)
+                : indexCount(indexCount), indexed(false), indexFormat(indexFormat), lods(std::move(lods)),
+                  boundingRadius(boundingRadius) {}
 
         virtual ~RenderMesh() = default;
 
         static std::unique_ptr<RenderMesh>
         Create(std::unique_ptr<Buffer> &&vertexBuffer, std::unique_ptr<Buffer> &&indexBuffer, size_t indexCount);
 
+        static std::unique_ptr<RenderMesh>
+        Create(std::unique_ptr<Buffer> &&vertexBuffer, std::unique_ptr<Buffer> &&indexBuffer, size_t indexCount,
+               IndexFormat indexFormat, std::vector<MeshLOD> &&lods, float boundingRadius);
+
+        /// Uploads the output of the MeshOptimizer
+        template<typename Vertex>
+        static std::unique_ptr<RenderMesh> Create(OptimizedMesh<Vertex> &&mesh) {
+            auto vertexBuffer = Buffer::Create(mesh.vertices.data(), mesh.vertices.size() * sizeof(Vertex),
+                                               BufferType::Vertex);
+            auto indexBuffer = Buffer::Create(mesh.indexData.data(), mesh.indexData.size(), BufferType::Index);
+            return Create(std::move(vertexBuffer), std::move(indexBuffer), mesh.indexCount, mesh.indexFormat,
+                          std::move(mesh.lods), mesh.boundingRadius);
+        }
+
         [[nodiscard]] inline uint32_t getIndexCount() const { return indexCount; }
 
+        [[nodiscard]] inline IndexFormat getIndexFormat() const { return indexFormat; }
+
+        [[nodiscard]] inline size_t getLODCount() const { return lods.size(); }
+
+        [[nodiscard]] inline float getBoundingRadius() const { return boundingRadius; }
+
+        /// Selects the most detailed LOD whose minimal screen size is reached by the projected size of the mesh
+        [[nodiscard]] const MeshLOD &selectLOD(float projectedSize) const {
+            for (const auto &lod: lods) {
+                if (projectedSize >= lod.minScreenSize)
+                    return lod;
+            }
+            return lods.back();
+        }
+
         [[nodiscard]] inline bool isIndexed() const { return indexed; }
 
         [[nodiscard]] virtual const Buffer *getVertexBuffer() const = 0;
@@ -28,6 +65,9 @@ namespace Renderer {
     private:
         uint32_t indexCount;
         bool indexed;
+        IndexFormat indexFormat;
+        std::vector<MeshLOD> lods;
+        float boundingRadius;
     };
 
 }
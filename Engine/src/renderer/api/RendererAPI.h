@@ -70,16 +70,16 @@ namespace Renderer {
 
         // ------------------------------------ Rendering commands -----------------------------------------------------
 
-        /// Render an object with its material and model matrix
-        virtual void draw(const glm::mat4 &viewMatrix, const RenderComponent &renderComponent) = 0;
+        /// Render an object with its material and 2D model matrix
+        virtual void draw(const GLMCustomExtension::Affine2D &modelMat, const RenderComponent &renderComponent) = 0;
 
         /// Render an indexed vertex buffer with its material
         virtual void drawText(const Buffer &vertexBuffer, const Buffer &indexBuffer,
                             uint32_t indexCount, uint32_t indexOffset,
-                            const glm::mat4 &modelMat, const MaterialInstance &materialInstance) = 0;
+                            const GLMCustomExtension::Affine2D &modelMat, const MaterialInstance &materialInstance) = 0;
 
-        /// Render a mesh with a material and model matrix
-        virtual void drawUI(const glm::mat4 &viewMatrix, const RenderMesh &mesh, const MaterialInstance &material) = 0;
+        /// Render a mesh with a material and 2D model matrix
+        virtual void drawUI(const GLMCustomExtension::Affine2D &modelMat, const RenderMesh &mesh, const MaterialInstance &material) = 0;
 
         /// Render scene debug data
         virtual void drawSceneDebug(const glm::mat4 &viewMat, const CameraComponent &camera,
@@ -4,6 +4,7 @@
 #include "renderer/vulkan/image/VulkanTexture.h"
 #include "renderer/testRenderer/TestTexture.h"
 #include "Engine/src/core/renderSystem/RenderingSystem.h"
+#include "core/assets/CookedAssets.h"
 #include "core/utils/Logger.h"
 
 #include <cassert>
@@ -11,13 +12,73 @@
 using namespace Renderer;
 using namespace Renderer::TestRenderer;
 
+/* The asset cooker stores textures as R8G8B8A8 KTX2 files with a complete mip chain. */
+static std::optional<std::string> findCookedTexture(const std::string &filename, ChaosEngine::ImageFormat format) {
+    if (format != ChaosEngine::ImageFormat::R8G8B8A8)
+        return std::nullopt;
+    return ChaosEngine::CookedAssets::findCooked(ChaosEngine::CookedAssets::getTexturePath("textures/" + filename));
+}
+
+Texture::SourceImage Texture::LoadSource(const Source &source) {
+    if (ChaosEngine::CompressedImage::isKTX2File(source.filename))
+        return ChaosEngine::CompressedImage::readKTX2("textures/" + source.filename);
+    if (const auto cooked = findCookedTexture(source.filename, source.format))
+        return ChaosEngine::CompressedImage::readKTX2(*cooked);
+    return ChaosEngine::RawImage::decodeImage("textures/" + source.filename, source.format);
+}
+
 std::unique_ptr<Texture>
 Texture::Create(const std::string &filename, const ChaosEngine::ImageFormat desiredFormat) {
     LOG_INFO("Loading texture {}", filename);
-    ChaosEngine::RawImage image = ChaosEngine::RawImage::readImage("textures/" + filename, desiredFormat);
-    return Create(image, "textures/" + filename);
+    Source source{filename, desiredFormat};
+    auto texture = std::visit([&](const auto &image) { return Create(image, "textures/" + filename); },
+                              LoadSource(source));
+    texture->source = std::move(source);
+    return texture;
 }
 
+std::vector<std::unique_ptr<Texture>>
+Texture::CreateBatch(const std::vector<std::pair<std::string, ChaosEngine::ImageFormat>> &files) {
+    // KTX2 files and cooked textures need no decoding, only the remaining files are decoded in parallel
+    std::vector<std::pair<std::string, ChaosEngine::ImageFormat>> decodePaths;
+    std::vector<size_t> decodeIndices;
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (!ChaosEngine::CompressedImage::isKTX2File(files[i].first) &&
+            !findCookedTexture(files[i].first, files[i].second)) {
+            LOG_INFO("Loading texture {}", files[i].first);
+            decodePaths.emplace_back("textures/" + files[i].first, files[i].second);
+            decodeIndices.emplace_back(i);
+        }
+    }
+    const auto images = ChaosEngine::RawImage::decodeImages(decodePaths);
+
+    std::vector<std::unique_ptr<Texture>> textures(files.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        textures[decodeIndices[i]] = Create(images[i], decodePaths[i].first);
+        textures[decodeIndices[i]]->source = Source{files[decodeIndices[i]].first, files[decodeIndices[i]].second};
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (textures[i] == nullptr)
+            textures[i] = Create(files[i].first, files[i].second);
+    }
+    return textures;
+}
+
+bool Texture::IsFormatSupported(ChaosEngine::ImageFormat format) {
+    switch (GraphicsContext::currentAPI) {
+        case GraphicsAPI::Vulkan: {
+            const auto &device = dynamic_cast<const VulkanContext &>(ChaosEngine::RenderingSystem::GetContext())
+                    .getDevice();
+            const auto vkFormat = VulkanImage::getVkFormat(format);
+            return device.isTextureFormatSupported(vkFormat) || device.isCompressedTextureFormatSupported(vkFormat);
+        }
+        case GraphicsAPI::Test:
+            return true;
+        default:
+            assert("Invalid Graphics API" && false);
+            return false;
+    }
+}
 
 std::unique_ptr<Texture> Texture::Create(const ChaosEngine::RawImage &rawImage,
                                          const std::optional<std::string> &debugName) {
@@ -35,3 +96,37 @@ std::unique_ptr<Texture> Texture::Create(const ChaosEngine::RawImage &rawImage,
             return nullptr;
     }
 }
+
+std::unique_ptr<Texture> Texture::Create(const ChaosEngine::DecodedImage &decodedImage,
+                                         const std::optional<std::string> &debugName) {
+    switch (GraphicsContext::currentAPI) {
+        case GraphicsAPI::Vulkan:
+            return std::make_unique<VulkanTexture>(
+                    VulkanTexture::Create(
+                            dynamic_cast<const VulkanContext &>(ChaosEngine::RenderingSystem::GetContext()),
+                            decodedImage, debugName));
+        case GraphicsAPI::Test:
+            return std::make_unique<TestTexture>(
+                    TestTexture::Create(dynamic_cast<const TestContext &>(ChaosEngine::RenderingSystem::GetContext())));
+        default:
+            assert("Invalid Graphics API" && false);
+            return nullptr;
+    }
+}
+
+std::unique_ptr<Texture> Texture::Create(const ChaosEngine::CompressedImage &compressedImage,
+                                         const std::optional<std::string> &debugName) {
+    switch (GraphicsContext::currentAPI) {
+        case GraphicsAPI::Vulkan:
+            return std::make_unique<VulkanTexture>(
+                    VulkanTexture::Create(
+                            dynamic_cast<const VulkanContext &>(ChaosEngine::RenderingSystem::GetContext()),
+                            compressedImage, debugName));
+        case GraphicsAPI::Test:
+            return std::make_unique<TestTexture>(
+                    TestTexture::Create(dynamic_cast<const TestContext &>(ChaosEngine::RenderingSystem::GetContext())));
+        default:
+            assert("Invalid Graphics API" && false);
+            return nullptr;
+    }
+}
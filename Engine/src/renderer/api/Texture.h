@@ -1,20 +1,37 @@
 #pragma once
 
 #include "core/assets/RawImage.h"
+#include "core/assets/CompressedImage.h"
 
 #include <string>
 #include <memory>
 #include <optional>
+#include <vector>
+#include <utility>
+#include <variant>
+#include <cstdint>
 
 namespace Renderer {
     class Texture {
+    public:
+        /// File a texture was loaded from, only textures with a source can be evicted and streamed back in
+        struct Source {
+            std::string filename; // In the `textures/` asset directory
+            ChaosEngine::ImageFormat format;
+        };
+
+        /// Full resolution image as loaded from the source, ready to be uploaded
+        using SourceImage = std::variant<ChaosEngine::DecodedImage, ChaosEngine::CompressedImage>;
+
     public:
         virtual ~Texture() = default;
 
         /**
          * Creates a texture from an image file to be used as a texture attachment in a shader.
+         * KTX2 files are uploaded with their block compressed format and mip chain, other images get their mip chain
+         * generated on load.
          * @param filename the path of the image in the `textures/` asset directory
-         * @param desiredFormat the format the image should be loaded to
+         * @param desiredFormat the format the image should be loaded to, ignored for KTX2 files
          * @return Created texture
          */
         static std::unique_ptr<Texture> Create(const std::string &filename,
@@ -22,6 +39,64 @@ namespace Renderer {
 
         static std::unique_ptr<Texture> Create(const ChaosEngine::RawImage &rawImage,
                                                const std::optional<std::string> &debugName = std::nullopt);
+
+        static std::unique_ptr<Texture> Create(const ChaosEngine::DecodedImage &decodedImage,
+                                               const std::optional<std::string> &debugName = std::nullopt);
+
+        static std::unique_ptr<Texture> Create(const ChaosEngine::CompressedImage &compressedImage,
+                                               const std::optional<std::string> &debugName = std::nullopt);
+
+        /// Checks if textures of this format can be created, block compressed formats are optional
+        static bool IsFormatSupported(ChaosEngine::ImageFormat format);
+
+        /**
+         * Creates multiple textures at once, the images are decoded in parallel before being uploaded.
+         * @param files filenames in the `textures/` asset directory and the format they should be loaded to
+         * @return Created textures in the order of the input
+         */
+        static std::vector<std::unique_ptr<Texture>>
+        CreateBatch(const std::vector<std::pair<std::string, ChaosEngine::ImageFormat>> &files);
+
+        /// Loads the image of a source the same way Create(filename) does, safe to be called from any thread
+        static SourceImage LoadSource(const Source &source);
+
+        // ------------------------------------ Residency --------------------------------------------------------------
+
+        [[nodiscard]] const std::optional<Source> &getSource() const { return source; }
+
+        /// Called by the renderer whenever the texture is referenced by a draw
+        inline void markUsed(uint64_t frame) const { lastUsedFrame = frame; }
+
+        [[nodiscard]] uint64_t getLastUsedFrame() const { return lastUsedFrame; }
+
+        /// Incremented whenever the GPU image is replaced, descriptors pointing to the old image MUST be rewritten
+        [[nodiscard]] uint32_t getGeneration() const { return generation; }
+
+        [[nodiscard]] bool isEvicted() const { return evicted; }
+
+        /// GPU memory currently occupied by the image
+        [[nodiscard]] virtual uint64_t getMemorySize() const { return 0; }
+
+        /// Checks if evict() would free anything, i.e. the image has mip levels no larger than maxExtent
+        [[nodiscard]] virtual bool canEvict(uint32_t /*maxExtent*/) const { return false; }
+
+        /**
+         * Replaces the image by its mip levels no larger than maxExtent, freeing the full resolution levels.
+         * @note The GPU MUST be idle, the old image is destroyed immediately
+         */
+        virtual void evict(uint32_t /*maxExtent*/) {}
+
+        /**
+         * Replaces the evicted low resolution image by the full resolution one.
+         * @note The GPU MUST be idle, the old image is destroyed immediately
+         */
+        virtual void restore(SourceImage &&/*image*/) {}
+
+    protected:
+        std::optional<Source> source = std::nullopt;
+        mutable uint64_t lastUsedFrame = 0;
+        uint32_t generation = 0;
+        bool evicted = false;
     };
 }
 
@@ -7,6 +7,8 @@
 #include "Engine/src/renderer/vulkan/pipeline/VulkanPipelineBuilder.h"
 #include "Engine/src/renderer/vulkan/api/VulkanRenderMesh.h"
 
+#include <algorithm>
+
 using namespace Renderer;
 
 // ------------------------------------ Class Members ------------------------------------------------------------------
@@ -29,7 +31,8 @@ SpriteRenderingPass::SpriteRenderingPass(SpriteRenderingPass &&o) noexcept:
         perFrameDescriptorSets(std::move(o.perFrameDescriptorSets)),
         perFrameUniformBuffers(std::move(o.perFrameUniformBuffers)),
         uboContent(std::move(o.uboContent)),
-        viewportSize(std::move(o.viewportSize)) {}
+        viewportSize(std::move(o.viewportSize)),
+        cameraHalfExtent(o.cameraHalfExtent) {}
 
 void SpriteRenderingPass::createAttachments(uint32_t width, uint32_t height) {
     framebuffer = std::make_unique<VulkanFramebuffer>(opaquePass->createFrameBuffer(
@@ -46,7 +49,7 @@ void SpriteRenderingPass::createStandardPipeline() {
                     .build());
 
     VulkanPipelineLayout pipelineLayout = VulkanPipelineLayoutBuilder(context.getDevice())
-            .addPushConstant(sizeof(glm::mat4), 0, Renderer::ShaderStage::Vertex)
+            .addPushConstant(sizeof(GLMCustomExtension::Affine2D), 0, Renderer::ShaderStage::Vertex)
             .addDescriptorSet(*cameraDescriptorLayout) // set = 0
             .build();
 
@@ -124,6 +127,7 @@ void SpriteRenderingPass::updateUniformBuffer(const glm::mat4 &viewMat, const Ca
 
 void SpriteRenderingPass::begin(const glm::mat4 &viewMat, const CameraComponent &camera) {
     updateUniformBuffer(viewMat, camera, viewportSize);
+    cameraHalfExtent = camera.fieldOfView;
 
     auto &commandBuffer = context.getCurrentPrimaryCommandBuffer();
     // Define render rendering to draw with
@@ -180,7 +184,7 @@ void SpriteRenderingPass::resizeAttachments(uint32_t width, uint32_t height) {
 }
 
 void
-SpriteRenderingPass::drawSprite(const VulkanRenderMesh &renderMesh, const glm::mat4 &modelMat,
+SpriteRenderingPass::drawSprite(const VulkanRenderMesh &renderMesh, const GLMCustomExtension::Affine2D &modelMat,
                                 const VulkanMaterialInstance &material) {
     auto &commandBuffer = context.getCurrentPrimaryCommandBuffer();
 
@@ -205,6 +209,7 @@ SpriteRenderingPass::drawSprite(const VulkanRenderMesh &renderMesh, const glm::m
     }
 
     // Bind Material
+    material.updateTextures();
     auto materialDescriptorSet = material.getDescriptorSet().vk();
     vkCmdBindDescriptorSets(commandBuffer.vk(), VK_PIPELINE_BIND_POINT_GRAPHICS, material.getPipelineLayout(), 1, 1,
                             &materialDescriptorSet, 0, nullptr);
@@ -217,7 +222,17 @@ SpriteRenderingPass::drawSprite(const VulkanRenderMesh &renderMesh, const glm::m
     VkDeviceSize offsets[] = {0};
     vkCmdBindVertexBuffers(commandBuffer.vk(), 0, 1, vertexBuffers, offsets);
     auto vIndexBuffer = dynamic_cast<const VulkanBuffer *>(renderMesh.getIndexBuffer())->vk();
-    vkCmdBindIndexBuffer(commandBuffer.vk(), vIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-    // Draw a fullscreen quad and composite the final image
-    vkCmdDrawIndexed(commandBuffer.vk(), renderMesh.getIndexCount(), 1, 0, 0, 0);
+    vkCmdBindIndexBuffer(commandBuffer.vk(), vIndexBuffer, 0,
+                         VulkanRenderMesh::getVkIndexType(renderMesh.getIndexFormat()));
+
+    const auto &lod = renderMesh.getLODCount() > 1 ? renderMesh.selectLOD(getProjectedSize(renderMesh, modelMat))
+                                                   : renderMesh.selectLOD(0.0f);
+    vkCmdDrawIndexed(commandBuffer.vk(), lod.indexCount, 1, lod.indexOffset, 0, 0);
+}
+
+float SpriteRenderingPass::getProjectedSize(const VulkanRenderMesh &renderMesh, const GLMCustomExtension::Affine2D &modelMat) const {
+    // The orthographic projection maps the field of view to half of the shorter viewport side
+    const float scale = std::max(glm::length(glm::vec2(modelMat.linear.x, modelMat.linear.y)),
+                                 glm::length(glm::vec2(modelMat.linear.z, modelMat.linear.w)));
+    return renderMesh.getBoundingRadius() * scale / cameraHalfExtent;
 }
@@ -48,7 +48,7 @@ public:
 
     void resizeAttachments(uint32_t width, uint32_t height);
 
-    void drawSprite(const VulkanRenderMesh &renderMesh, const glm::mat4 &modelMat,
+    void drawSprite(const VulkanRenderMesh &renderMesh, const GLMCustomExtension::Affine2D &modelMat,
                     const VulkanMaterialInstance &material);
 
     inline const VulkanRenderPass &getOpaquePass() const { return *opaquePass; }
@@ -63,6 +63,9 @@ private:
 
     void createStandardPipeline();
 
+    /// Bounding diameter of the mesh relative to the shorter viewport side
+    [[nodiscard]] float getProjectedSize(const VulkanRenderMesh &renderMesh, const GLMCustomExtension::Affine2D &modelMat) const;
+
 private:
     const VulkanContext &context;
     std::unique_ptr<VulkanRenderPass> opaquePass;
@@ -81,5 +84,6 @@ private:
 
     // State resources --------------------------------------------------------
     glm::uvec2 viewportSize{0, 0};
+    float cameraHalfExtent = 1.0f;
 };
 
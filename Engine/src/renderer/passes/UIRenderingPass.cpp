@@ -47,7 +47,7 @@ void UIRenderingPass::createStandardPipeline() {
                     .build());
 
     VulkanPipelineLayout pipelineLayout = VulkanPipelineLayoutBuilder(context.getDevice())
-            .addPushConstant(sizeof(glm::mat4), 0, Renderer::ShaderStage::Vertex)
+            .addPushConstant(sizeof(GLMCustomExtension::Affine2D), 0, Renderer::ShaderStage::Vertex)
             .addDescriptorSet(*canvasDescriptorLayout) // set = 0
             .build();
 
@@ -178,9 +178,9 @@ void UIRenderingPass::resizeAttachments(uint32_t width, uint32_t height) {
 }
 
 void
-UIRenderingPass::drawUI(const VulkanBuffer &vertexBuffer, const VulkanBuffer &indexBuffer,
+UIRenderingPass::drawUI(const VulkanBuffer &vertexBuffer, const VulkanBuffer &indexBuffer, IndexFormat indexFormat,
                         uint32_t indexCount, uint32_t indexOffset,
-                        const glm::mat4 &modelMat, const VulkanMaterialInstance &material) {
+                        const GLMCustomExtension::Affine2D &modelMat, const VulkanMaterialInstance &material) {
     auto &commandBuffer = context.getCurrentPrimaryCommandBuffer();
 
     // Bind Material TODO: The pipeline should be bound for a group of objects
@@ -204,6 +204,7 @@ UIRenderingPass::drawUI(const VulkanBuffer &vertexBuffer, const VulkanBuffer &in
     }
 
     // Bind Material
+    material.updateTextures();
     auto materialDescriptorSet = material.getDescriptorSet().vk();
     vkCmdBindDescriptorSets(commandBuffer.vk(), VK_PIPELINE_BIND_POINT_GRAPHICS, material.getPipelineLayout(), 1, 1,
                             &materialDescriptorSet, 0, nullptr);
@@ -215,7 +216,7 @@ UIRenderingPass::drawUI(const VulkanBuffer &vertexBuffer, const VulkanBuffer &in
     VkBuffer vertexBuffers[]{vertexBuffer.vk()};
     VkDeviceSize offsets[] = {0};
     vkCmdBindVertexBuffers(commandBuffer.vk(), 0, 1, vertexBuffers, offsets);
-    vkCmdBindIndexBuffer(commandBuffer.vk(), indexBuffer.vk(), 0, VK_INDEX_TYPE_UINT32);
+    vkCmdBindIndexBuffer(commandBuffer.vk(), indexBuffer.vk(), 0, VulkanRenderMesh::getVkIndexType(indexFormat));
     // Draw a fullscreen quad and composite the final image
     vkCmdDrawIndexed(commandBuffer.vk(), indexCount, 1, indexOffset, 0, 0);
 }
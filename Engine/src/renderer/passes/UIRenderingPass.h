@@ -49,8 +49,9 @@ public:
     void resizeAttachments(uint32_t width, uint32_t height);
 
     void
-    drawUI(const VulkanBuffer &vertexBuffer, const VulkanBuffer &indexBuffer, uint32_t indexCount, uint32_t indexOffset,
-           const glm::mat4 &modelMat, const VulkanMaterialInstance &material);
+    drawUI(const VulkanBuffer &vertexBuffer, const VulkanBuffer &indexBuffer, IndexFormat indexFormat,
+           uint32_t indexCount, uint32_t indexOffset, const GLMCustomExtension::Affine2D &modelMat,
+           const VulkanMaterialInstance &material);
 
     inline const VulkanRenderPass &getOpaquePass() const { return *opaquePass; }
 
@@ -19,6 +19,7 @@ void TestContext::destroyBuffered(std::unique_ptr<BufferedGPUResource> /*resourc
 
 void TestContext::tickFrame() {
     LOG_DEBUG(__PRETTY_FUNCTION__);
+    ++frameCounter;
 }
 
 void TestContext::waitIdle() {
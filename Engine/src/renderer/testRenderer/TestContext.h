@@ -27,11 +27,14 @@ namespace Renderer::TestRenderer {
 
         void tickFrame() override;
 
+        [[nodiscard]] uint32_t getFrameCounter() const override { return frameCounter; }
+
         void waitIdle() override;
 
     private:
         // Context
         const Window &window;
+        uint32_t frameCounter = 0;
     };
 }
 
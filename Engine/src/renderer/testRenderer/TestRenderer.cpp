@@ -59,17 +59,17 @@ void TestRenderer::requestViewportResize(const glm::vec2 &/*viewportSize*/) {
     LOG_DEBUG(__PRETTY_FUNCTION__);
 }
 
-void TestRenderer::draw(const glm::mat4 &/*viewMatrix*/, const RenderComponent &/*renderComponent*/) {
+void TestRenderer::draw(const GLMCustomExtension::Affine2D &/*modelMat*/, const RenderComponent &/*renderComponent*/) {
     LOG_DEBUG(__PRETTY_FUNCTION__);
 }
 
 void TestRenderer::drawText(const Buffer &/*vertexBuffer*/, const Buffer &/*indexBuffer*/,
                             uint32_t /*indexCount*/, uint32_t /*indexOffset*/,
-                            const glm::mat4 &/*modelMat*/, const MaterialInstance &/*materialInstance*/) {
+                            const GLMCustomExtension::Affine2D &/*modelMat*/, const MaterialInstance &/*materialInstance*/) {
     LOG_DEBUG(__PRETTY_FUNCTION__);
 }
 
-void TestRenderer::drawUI(const glm::mat4 &/*viewMatrix*/, const Renderer::RenderMesh &/*mesh*/,
+void TestRenderer::drawUI(const GLMCustomExtension::Affine2D &/*modelMat*/, const Renderer::RenderMesh &/*mesh*/,
                           const Renderer::MaterialInstance &/*material*/) {
     LOG_DEBUG(__PRETTY_FUNCTION__);
 }
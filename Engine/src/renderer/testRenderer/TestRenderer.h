@@ -66,15 +66,15 @@ namespace Renderer::TestRenderer {
         // ------------------------------------ Rendering commands -----------------------------------------------------
 
         /// Render an object with its material and model matrix
-        void draw(const glm::mat4 &modelMat, const RenderComponent &renderComponent) override;
+        void draw(const GLMCustomExtension::Affine2D &modelMat, const RenderComponent &renderComponent) override;
 
         /// Render an indexed vertex buffer with its material
         void drawText(const Buffer &vertexBuffer, const Buffer &indexBuffer,
                     uint32_t indexCount, uint32_t indexOffset,
-                    const glm::mat4 &modelMat, const MaterialInstance &materialInstance) override;
+                    const GLMCustomExtension::Affine2D &modelMat, const MaterialInstance &materialInstance) override;
 
         /// Render a mesh with a material and model matrix
-        void drawUI(const glm::mat4 &viewMatrix, const RenderMesh &mesh, const MaterialInstance &material) override;
+        void drawUI(const GLMCustomExtension::Affine2D &modelMat, const RenderMesh &mesh, const MaterialInstance &material) override;
 
         /// Render scene debug data
         void drawSceneDebug(const glm::mat4 &viewMat, const CameraComponent &camera,
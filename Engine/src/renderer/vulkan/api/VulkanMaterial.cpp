@@ -137,6 +137,7 @@ VulkanMaterial::instantiate(std::shared_ptr<Material> &materialPtr, const void *
     }
 
     // Update descriptor set-1 to the resources for this instance
+    std::vector<VulkanMaterialInstance::TextureBinding> textureBindings;
     auto writer = descriptorSet.startWriting();
     auto texturesIt = textures.begin();
     for (uint32_t i = 0; i < info.set1.value().size(); ++i) {
@@ -151,12 +152,14 @@ VulkanMaterial::instantiate(std::shared_ptr<Material> &materialPtr, const void *
                     throw std::runtime_error("Missing textures.");
                 const auto *tex = dynamic_cast<const VulkanTexture *>(*texturesIt);
                 writer.writeImageSampler(i, tex->getSampler(), tex->getImageView(), tex->getImageLayout());
+                textureBindings.emplace_back(VulkanMaterialInstance::TextureBinding{i, tex, tex->getGeneration()});
                 ++texturesIt;
                 break;
         }
     }
     writer.commit();
-    auto instance = std::make_unique<VulkanMaterialInstance>(materialPtr, std::move(descriptorSet), currentOffset);
+    auto instance = std::make_unique<VulkanMaterialInstance>(materialPtr, std::move(descriptorSet), currentOffset,
+                                                             std::move(textureBindings));
 
     // Set offset data for the uniform buffer accordingly
     auto paddedSize = vulkanContext.getMemory().sizeWithUboPadding(materialBufferSize);
@@ -164,3 +167,24 @@ VulkanMaterial::instantiate(std::shared_ptr<Material> &materialPtr, const void *
         nextSetOffset += paddedSize;
     return instance;
 }
+
+void VulkanMaterialInstance::updateTextures() const {
+    const uint64_t frame = material->getContext().getFrameCounter();
+    bool replaced = false;
+    for (const auto &textureBinding: textureBindings) {
+        textureBinding.texture->markUsed(frame);
+        replaced |= textureBinding.generation != textureBinding.texture->getGeneration();
+    }
+    if (!replaced)
+        return;
+
+    auto writer = VulkanDescriptorSet(descriptorSet).startWriting();
+    for (auto &textureBinding: textureBindings) {
+        if (textureBinding.generation == textureBinding.texture->getGeneration())
+            continue;
+        writer.writeImageSampler(textureBinding.binding, textureBinding.texture->getSampler(),
+                                 textureBinding.texture->getImageView(), textureBinding.texture->getImageLayout());
+        textureBinding.generation = textureBinding.texture->getGeneration();
+    }
+    writer.commit();
+}
@@ -116,11 +116,19 @@ private:
         uint32_t uniformBufferOffset;
     };
 
+public:
+    /// Texture written to a binding of the descriptor set, with the generation of the image that was written
+    struct TextureBinding {
+        uint32_t binding;
+        const VulkanTexture *texture;
+        uint32_t generation;
+    };
+
 public:
     VulkanMaterialInstance(std::shared_ptr<Renderer::Material> material, VulkanDescriptorSet &&descriptorSet,
-                           uint32_t uniformBufferOffset)
+                           uint32_t uniformBufferOffset, std::vector<TextureBinding> &&textureBindings)
             : material(std::move(material)), descriptorSet(descriptorSet),
-              uniformBufferOffset(uniformBufferOffset) {}
+              uniformBufferOffset(uniformBufferOffset), textureBindings(std::move(textureBindings)) {}
 
     VulkanMaterialInstance(const VulkanMaterialInstance &o) = delete;
 
@@ -128,7 +136,7 @@ public:
 
     VulkanMaterialInstance(VulkanMaterialInstance &&o) noexcept
             : material(std::move(o.material)), descriptorSet(std::move(o.descriptorSet)),
-              uniformBufferOffset(o.uniformBufferOffset) {}
+              uniformBufferOffset(o.uniformBufferOffset), textureBindings(std::move(o.textureBindings)) {}
 
     VulkanMaterialInstance &operator=(VulkanMaterialInstance &&o) = delete;
 
@@ -148,6 +156,13 @@ public:
 
     inline const VulkanDescriptorSet &getDescriptorSet() const { return descriptorSet; }
 
+    /**
+     * Marks the textures as used in the current frame and rewrites the descriptors of textures whose image has been
+     * replaced by the texture streamer. MUST be called before the descriptor set is bound. <br>
+     * Images are only replaced while the GPU is idle, so the set can not be in use when it is rewritten here.
+     */
+    void updateTextures() const;
+
     inline VkPipelineLayout
     getPipelineLayout() const { return dynamic_cast<VulkanMaterial *>(material.get())->pipeline->getPipelineLayout(); }
 
@@ -163,6 +178,7 @@ private:
     std::shared_ptr<Renderer::Material> material;
     VulkanDescriptorSet descriptorSet;
     uint32_t uniformBufferOffset;
+    mutable std::vector<TextureBinding> textureBindings;
 };
 
 
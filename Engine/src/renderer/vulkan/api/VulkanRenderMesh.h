@@ -10,12 +10,21 @@ public:
     VulkanRenderMesh(VulkanBuffer &&vertexBuffer, VulkanBuffer &&indexBuffer, uint32_t indexCount)
             : RenderMesh(indexCount), vertexBuffer(std::move(vertexBuffer)), indexBuffer(std::move(indexBuffer)) {}
 
+    VulkanRenderMesh(VulkanBuffer &&vertexBuffer, VulkanBuffer &&indexBuffer, uint32_t indexCount,
+                     IndexFormat indexFormat, std::vector<MeshLOD> &&lods, float boundingRadius)
+            : RenderMesh(indexCount, indexFormat, std::move(lods), boundingRadius),
+              vertexBuffer(std::move(vertexBuffer)), indexBuffer(std::move(indexBuffer)) {}
+
     ~VulkanRenderMesh() override = default;
 
     [[nodiscard]] const Renderer::Buffer *getVertexBuffer() const override { return &vertexBuffer; }
 
     [[nodiscard]] const Renderer::Buffer *getIndexBuffer() const override { return &indexBuffer; }
 
+    static VkIndexType getVkIndexType(IndexFormat format) {
+        return format == IndexFormat::UInt16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    }
+
 public:
     static const VulkanVertexInput vertex_3P_3C_3N_2U;
 private:
@@ -43,6 +43,8 @@ public:
 
     void tickFrame() override;
 
+    [[nodiscard]] uint32_t getFrameCounter() const override { return currentFrameCounter; }
+
     void waitIdle() override { device.waitIdle(); }
 
     [[nodiscard]] inline const Window &getWindow() const { return window; }
@@ -234,7 +234,7 @@ pickPhysicalDevice(const VulkanInstance &instance, VkSurfaceKHR surface) {
 }
 
 /* Creates the logical vulkan device from the physical device. */
-static VkDevice
+static std::tuple<VkDevice, VkPhysicalDeviceFeatures>
 createLogicalDevice(VkPhysicalDevice physicalDevice, const VulkanInstance &instance, QueueFamilyIndices indices) {
 
     // Create the queues
@@ -260,6 +260,10 @@ createLogicalDevice(VkPhysicalDevice physicalDevice, const VulkanInstance &insta
     deviceFeatures.samplerAnisotropy = VK_TRUE; // needed for texture filtering
     deviceFeatures.fillModeNonSolid = VK_TRUE; // Enable Line and Point Primitives
     deviceFeatures.wideLines = VK_TRUE; // Enable Line width > 1.0
+    // Optional device features
+    VkPhysicalDeviceFeatures supportedDeviceFeatures;
+    vkGetPhysicalDeviceFeatures(physicalDevice, &supportedDeviceFeatures);
+    deviceFeatures.textureCompressionBC = supportedDeviceFeatures.textureCompressionBC; // BC4/BC5/BC7 textures
 
     // Create the logical device
     VkDeviceCreateInfo createInfo = {};
@@ -285,7 +289,7 @@ createLogicalDevice(VkPhysicalDevice physicalDevice, const VulkanInstance &insta
         throw std::runtime_error("failed to create logical device!");
     }
 
-    return device;
+    return std::make_tuple(device, deviceFeatures);
 }
 
 // Retrieve the graphics queue
@@ -334,7 +338,7 @@ VulkanDevice VulkanDevice::Create(const VulkanInstance &instance, VkSurfaceKHR s
     // Get queues to be created
     QueueFamilyIndices indices = ::findQueueFamilies(physicalDevice, surface);
     // Create the logical device for this GPU
-    auto device = ::createLogicalDevice(physicalDevice, instance, indices);
+    auto[device, enabledFeatures] = ::createLogicalDevice(physicalDevice, instance, indices);
 
     auto[graphicsQueue, graphicsQueueFamilyIndex] = ::getGraphicsQueue(device, indices);
     auto[presentQueue, presentQueueFamilyIndex] = ::getPresentQueue(device, indices);
@@ -355,7 +359,7 @@ VulkanDevice VulkanDevice::Create(const VulkanInstance &instance, VkSurfaceKHR s
                         graphicsQueue, graphicsQueueFamilyIndex,
                         presentQueue, presentQueueFamilyIndex,
                         transferQueue, transferQueueFamilyIndex,
-                        indices, deviceProperties, instance};
+                        indices, deviceProperties, enabledFeatures, instance};
 }
 
 VulkanDevice::VulkanDevice(VkPhysicalDevice physicalDevice, VkDevice device, VkQueue graphicsQueue,
@@ -363,12 +367,12 @@ VulkanDevice::VulkanDevice(VkPhysicalDevice physicalDevice, VkDevice device, VkQ
                            VkQueue presentQueue, uint32_t presentQueueFamily, VkQueue transferQueue,
                            uint32_t transferQueueFamily,
                            QueueFamilyIndices queueFamilyIndices, VkPhysicalDeviceProperties properties,
-                           const VulkanInstance &instance)
+                           VkPhysicalDeviceFeatures enabledFeatures, const VulkanInstance &instance)
         : instance(instance), physicalDevice(physicalDevice), device(device),
           graphicsQueue(graphicsQueue), graphicsQueueFamilyIndex(graphicsQueueFamily),
           presentQueue(presentQueue), presentQueueFamilyIndex(presentQueueFamily),
           transferQueue(transferQueue), transferQueueFamilyIndex(transferQueueFamily),
-          queueFamilyIndices(queueFamilyIndices), properties(properties) {}
+          queueFamilyIndices(queueFamilyIndices), properties(properties), enabledFeatures(enabledFeatures) {}
 
 VulkanDevice::VulkanDevice(VulkanDevice &&o) noexcept
         : instance(o.instance),
@@ -377,7 +381,8 @@ VulkanDevice::VulkanDevice(VulkanDevice &&o) noexcept
           graphicsQueue(std::exchange(o.graphicsQueue, nullptr)), graphicsQueueFamilyIndex(o.graphicsQueueFamilyIndex),
           presentQueue(std::exchange(o.presentQueue, nullptr)), presentQueueFamilyIndex(o.presentQueueFamilyIndex),
           transferQueue(std::exchange(o.transferQueue, nullptr)), transferQueueFamilyIndex(o.transferQueueFamilyIndex),
-          queueFamilyIndices(std::move(o.queueFamilyIndices)), properties(o.properties) {
+          queueFamilyIndices(std::move(o.queueFamilyIndices)), properties(o.properties),
+          enabledFeatures(o.enabledFeatures) {
 }
 
 VulkanDevice::~VulkanDevice() { destroy(); }
@@ -420,4 +425,20 @@ bool VulkanDevice::checkSurfaceAvailability(VkSurfaceKHR newSurface) const {
 
 bool VulkanDevice::isTextureFormatSupported(VkFormat format) const {
     return ::isTextureFormatSupported(physicalDevice, format);
+}
+
+bool VulkanDevice::isCompressedTextureFormatSupported(VkFormat format) const {
+    if (!enabledFeatures.textureCompressionBC)
+        return false;
+    VkFormatProperties props{};
+    vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &props);
+    return (props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+}
+
+bool VulkanDevice::isLinearBlitSupported(VkFormat format) const {
+    VkFormatProperties props{};
+    vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &props);
+    constexpr VkFormatFeatureFlags required = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+                                              VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+    return (props.optimalTilingFeatures & required) == required;
 }
\ No newline at end of file
@@ -41,7 +41,7 @@ private:
                  VkQueue presentQueue, uint32_t presentQueueFamily,
                  VkQueue transferQueue, uint32_t transferQueueFamily,
                  QueueFamilyIndices queueFamilyIndices, VkPhysicalDeviceProperties properties,
-                 const VulkanInstance &instance);
+                 VkPhysicalDeviceFeatures enabledFeatures, const VulkanInstance &instance);
 
     void destroy();
 
@@ -67,6 +67,8 @@ public:
 
     [[nodiscard]] inline VkPhysicalDeviceProperties getProperties() const { return properties; }
 
+    [[nodiscard]] inline const VkPhysicalDeviceFeatures &getEnabledFeatures() const { return enabledFeatures; }
+
     [[nodiscard]] inline VkQueue getGraphicsQueue() const { return graphicsQueue; }
 
     [[nodiscard]] inline VkQueue getPresentQueue() const { return presentQueue; }
@@ -94,6 +96,12 @@ public:
 
     [[nodiscard]] bool isTextureFormatSupported(VkFormat format) const;
 
+    /// Checks if a block compressed format can be sampled, requires the textureCompressionBC feature
+    [[nodiscard]] bool isCompressedTextureFormatSupported(VkFormat format) const;
+
+    /// Checks if a format supports linear filtered blits with optimal tiling, needed for mip generation
+    [[nodiscard]] bool isLinearBlitSupported(VkFormat format) const;
+
 // ------------------------------------ Debug Members ------------------------------------------------------------------
 
     inline void setDebugName(VkObjectType type, uint64_t handle, const std::optional<std::string> &name) const {
@@ -116,5 +124,6 @@ private:
     QueueFamilyIndices queueFamilyIndices;
 
     VkPhysicalDeviceProperties properties;
+    VkPhysicalDeviceFeatures enabledFeatures;
 };
 
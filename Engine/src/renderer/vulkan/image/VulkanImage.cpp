@@ -1,7 +1,11 @@
 #include "VulkanImage.h"
 #include "Engine/src/renderer/vulkan/memory/VulkanBuffer.h"
+#include "Engine/src/renderer/vulkan/command/VulkanCommandPool.h"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
+#include <vector>
 
 using namespace ChaosEngine;
 
@@ -15,6 +19,12 @@ VkFormat VulkanImage::getVkFormat(ImageFormat format) {
             return VK_FORMAT_R32_SFLOAT;
         case ImageFormat::Rf32Gf32Bf32Af32:
             return VK_FORMAT_R32G32B32A32_SFLOAT;
+        case ImageFormat::BC4_R:
+            return VK_FORMAT_BC4_UNORM_BLOCK;
+        case ImageFormat::BC5_RG:
+            return VK_FORMAT_BC5_UNORM_BLOCK;
+        case ImageFormat::BC7_RGBA:
+            return VK_FORMAT_BC7_UNORM_BLOCK;
         default:
             assert(("Unknown image format"));
             return VK_FORMAT_R8G8B8A8_UNORM;
@@ -22,9 +32,18 @@ VkFormat VulkanImage::getVkFormat(ImageFormat format) {
     }
 }
 
+uint32_t VulkanImage::calculateMipLevels(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size /= 2) {
+        ++levels;
+    }
+    return levels;
+}
+
 /* Creates an image for use as a texture from a file. */
 VulkanImage
-VulkanImage::Create(const VulkanMemory &vulkanMemory, const ChaosEngine::RawImage &rawImage) {
+VulkanImage::Create(const VulkanMemory &vulkanMemory, const VulkanCommandPool &graphicsCommandPool,
+                    const ChaosEngine::RawImage &rawImage) {
 
     // Staging buffer to contain data for transfer
     // Creates buffer with usage=transfer_src, host visible and coherent meaning the cpu has access to the memory and changes are immediately known to the driver which will transfer the memmory before the next vkQueueSubmit
@@ -33,25 +52,229 @@ VulkanImage::Create(const VulkanMemory &vulkanMemory, const ChaosEngine::RawImag
     // Copy the image to the staging buffer
     vulkanMemory.copyDataToBuffer(stagingBuffer, rawImage.getPixels(), rawImage.getSize(), 0);
 
-    const auto imageFormat = getVkFormat(rawImage.getFormat());
+    return createFromStagingBuffer(vulkanMemory, graphicsCommandPool, stagingBuffer, rawImage.getWidth(),
+                                   rawImage.getHeight(), rawImage.getFormat());
+}
+
+/* Creates an image for use as a texture from a decoded file. */
+VulkanImage
+VulkanImage::Create(const VulkanMemory &vulkanMemory, const VulkanCommandPool &graphicsCommandPool,
+                    const ChaosEngine::DecodedImage &decodedImage) {
+    auto stagingBuffer = vulkanMemory.createBuffer(decodedImage.getSize(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                                   VMA_MEMORY_USAGE_CPU_TO_GPU);
+    // The format conversion writes straight into the staging memory
+    decodedImage.convertInto(stagingBuffer.map());
+    stagingBuffer.unmap();
+
+    return createFromStagingBuffer(vulkanMemory, graphicsCommandPool, stagingBuffer, decodedImage.getWidth(),
+                                   decodedImage.getHeight(), decodedImage.getFormat());
+}
+
+/* Creates an image for use as a texture from a KTX2 file including all its mip levels. */
+VulkanImage VulkanImage::Create(const VulkanMemory &vulkanMemory, const ChaosEngine::CompressedImage &compressedImage) {
+    const auto imageFormat = getVkFormat(compressedImage.getFormat());
+    if (CompressedImage::isBlockCompressed(compressedImage.getFormat())
+        ? !vulkanMemory.getDevice().isCompressedTextureFormatSupported(imageFormat)
+        : !vulkanMemory.getDevice().isTextureFormatSupported(imageFormat)) {
+        throw std::runtime_error("[Vulkan] Texture format is not supported by this device!");
+    }
+
+    // Pack all levels into one staging buffer, offsets MUST be multiples of the block size and 4
+    const auto &levels = compressedImage.getLevels();
+    const uint64_t alignment = std::max(CompressedImage::getBlockSize(compressedImage.getFormat()), 4u);
+    std::vector<VkBufferImageCopy> regions;
+    regions.reserve(levels.size());
+    uint64_t stagingSize = 0;
+    for (uint32_t i = 0; i < levels.size(); ++i) {
+        VkBufferImageCopy region = {};
+        region.bufferOffset = stagingSize;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = i;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent = {levels[i].width, levels[i].height, 1};
+        regions.emplace_back(region);
+        stagingSize += (levels[i].size + alignment - 1) / alignment * alignment;
+    }
+
+    auto stagingBuffer = vulkanMemory.createBuffer(stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                                   VMA_MEMORY_USAGE_CPU_TO_GPU);
+    auto *staging = static_cast<char *>(stagingBuffer.map());
+    for (uint32_t i = 0; i < levels.size(); ++i) {
+        std::memcpy(staging + regions[i].bufferOffset, compressedImage.getData() + levels[i].offset, levels[i].size);
+    }
+    stagingBuffer.unmap();
+
+    const auto mipLevels = static_cast<uint32_t>(levels.size());
+    // Transfer source to allow copying the mip tail when the texture gets evicted
+    auto image = vulkanMemory.createImage(compressedImage.getWidth(), compressedImage.getHeight(), imageFormat,
+                                          VK_IMAGE_TILING_OPTIMAL,
+                                          VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                                          VK_IMAGE_USAGE_SAMPLED_BIT,
+                                          VMA_MEMORY_USAGE_GPU_ONLY, false, mipLevels);
+
+    transitionImageLayout(vulkanMemory, image.vk(), imageFormat,
+                          VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels);
+    vulkanMemory.copyBufferToImage(stagingBuffer, image, regions);
+    transitionImageLayout(vulkanMemory, image.vk(), imageFormat,
+                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels);
+    return image;
+}
+
+VulkanImage VulkanImage::createFromStagingBuffer(const VulkanMemory &vulkanMemory,
+                                                 const VulkanCommandPool &graphicsCommandPool,
+                                                 const VulkanBuffer &stagingBuffer,
+                                                 uint32_t width, uint32_t height, ImageFormat format) {
+    const auto imageFormat = getVkFormat(format);
+    // Formats without linear filtered blits only get the base level
+    const uint32_t mipLevels = vulkanMemory.getDevice().isLinearBlitSupported(imageFormat)
+                               ? calculateMipLevels(width, height) : 1;
     // Create the image and its memory
-    auto image = vulkanMemory.createImage(rawImage.getWidth(), rawImage.getHeight(),
+    auto image = vulkanMemory.createImage(width, height,
                                           imageFormat,
                                           VK_IMAGE_TILING_OPTIMAL,
-                                          VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-                                          VMA_MEMORY_USAGE_GPU_ONLY);
+                                          VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                                          VK_IMAGE_USAGE_SAMPLED_BIT,
+                                          VMA_MEMORY_USAGE_GPU_ONLY, false, mipLevels);
 
     // Transition the image to the transfer destination layout
     transitionImageLayout(vulkanMemory, image.vk(), imageFormat,
-                          VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+                          VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels);
     // Copy image data into image from buffer
-    vulkanMemory.copyBufferToImage(stagingBuffer, image, rawImage.getWidth(), rawImage.getHeight());
-    // Transfer the image layout to the fragment shader read layout
-    transitionImageLayout(vulkanMemory, image.vk(), imageFormat,
-                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vulkanMemory.copyBufferToImage(stagingBuffer, image, width, height);
+    if (mipLevels > 1) {
+        // Blits are not available on transfer only queues
+        generateMipmaps(graphicsCommandPool, image);
+    } else {
+        // Transfer the image layout to the fragment shader read layout
+        transitionImageLayout(vulkanMemory, image.vk(), imageFormat,
+                              VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
 
     assert("Raw Image and Texture Image differ in dimensions!" &&
-           rawImage.getWidth() == image.getWidth() && rawImage.getHeight() == image.getHeight());
+           width == image.getWidth() && height == image.getHeight());
+    return image;
+}
+
+void VulkanImage::generateMipmaps(const VulkanCommandPool &graphicsCommandPool, const VulkanImage &image) {
+    graphicsCommandPool.runInSingeTimeCommandBuffer([&](VkCommandBuffer commandBuffer) {
+        VkImageMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image.vk();
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+
+        auto mipWidth = static_cast<int32_t>(image.getWidth());
+        auto mipHeight = static_cast<int32_t>(image.getHeight());
+        for (uint32_t level = 1; level < image.getMipLevels(); ++level) {
+            // The previous level has been written by the copy or the last blit and is now read
+            barrier.subresourceRange.baseMipLevel = level - 1;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                                 0, nullptr, 0, nullptr, 1, &barrier);
+
+            const int32_t nextWidth = std::max(1, mipWidth / 2);
+            const int32_t nextHeight = std::max(1, mipHeight / 2);
+            VkImageBlit blit = {};
+            blit.srcOffsets[0] = {0, 0, 0};
+            blit.srcOffsets[1] = {mipWidth, mipHeight, 1};
+            blit.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, level - 1, 0, 1};
+            blit.dstOffsets[0] = {0, 0, 0};
+            blit.dstOffsets[1] = {nextWidth, nextHeight, 1};
+            blit.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1};
+            vkCmdBlitImage(commandBuffer, image.vk(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           image.vk(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+
+            // The previous level is done
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+            mipWidth = nextWidth;
+            mipHeight = nextHeight;
+        }
+
+        // The last level has only been written
+        barrier.subresourceRange.baseMipLevel = image.getMipLevels() - 1;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+    });
+}
+
+/* Creates a texture image from the smaller levels of an existing one. */
+VulkanImage VulkanImage::createMipTail(const VulkanMemory &vulkanMemory, const VulkanCommandPool &graphicsCommandPool,
+                                       const VulkanImage &source, uint32_t firstLevel) {
+    assert("The mip tail MUST start at an existing level!" && firstLevel < source.getMipLevels());
+    const uint32_t mipLevels = source.getMipLevels() - firstLevel;
+    auto image = vulkanMemory.createImage(std::max(1u, source.getWidth() >> firstLevel),
+                                          std::max(1u, source.getHeight() >> firstLevel), source.getFormat(),
+                                          VK_IMAGE_TILING_OPTIMAL,
+                                          VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                                          VMA_MEMORY_USAGE_GPU_ONLY, false, mipLevels);
+
+    graphicsCommandPool.runInSingeTimeCommandBuffer([&](VkCommandBuffer commandBuffer) {
+        VkImageMemoryBarrier barriers[2] = {};
+        for (auto &barrier: barriers) {
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.levelCount = mipLevels;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount = 1;
+        }
+        barriers[0].image = source.vk();
+        barriers[0].subresourceRange.baseMipLevel = firstLevel;
+        barriers[0].oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barriers[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        barriers[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barriers[1].image = image.vk();
+        barriers[1].subresourceRange.baseMipLevel = 0;
+        barriers[1].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barriers[1].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barriers[1].srcAccessMask = 0;
+        barriers[1].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                             0, nullptr, 0, nullptr, 2, barriers);
+
+        // Level extents of the tail match the source levels exactly, even for block compressed formats
+        std::vector<VkImageCopy> regions(mipLevels);
+        for (uint32_t level = 0; level < mipLevels; ++level) {
+            regions[level].srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, firstLevel + level, 0, 1};
+            regions[level].dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1};
+            regions[level].extent = {std::max(1u, source.getWidth() >> (firstLevel + level)),
+                                     std::max(1u, source.getHeight() >> (firstLevel + level)), 1};
+        }
+        vkCmdCopyImage(commandBuffer, source.vk(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                       image.vk(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                       static_cast<uint32_t>(regions.size()), regions.data());
+
+        barriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barriers[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barriers[0].srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        barriers[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barriers[1].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barriers[1].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                             0, nullptr, 0, nullptr, 2, barriers);
+    });
     return image;
 }
 
@@ -81,7 +304,7 @@ VulkanImage::createRawImage(const VulkanMemory &vulkanMemory, uint32_t width, ui
 void
 VulkanImage::transitionImageLayout(const VulkanMemory &vulkanMemory, VkImage image, VkFormat format,
                                    VkImageLayout oldLayout,
-                                   VkImageLayout newLayout) {
+                                   VkImageLayout newLayout, uint32_t mipLevels) {
     // TODO: Refactor to a more convenient and understandable solution
     vulkanMemory.getTransferCommandPool().runInSingeTimeCommandBuffer([&](VkCommandBuffer commandBuffer) {
 
@@ -104,8 +327,8 @@ VulkanImage::transitionImageLayout(const VulkanMemory &vulkanMemory, VkImage ima
             barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         }
 
-        barrier.subresourceRange.baseMipLevel = 0; // no mipmapping
-        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = mipLevels;
         barrier.subresourceRange.baseArrayLayer = 0; // single layer
         barrier.subresourceRange.layerCount = 1;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/src/core/assets/RawImage.h"
+#include "Engine/src/core/assets/CompressedImage.h"
 
 #include "Engine/src/renderer/vulkan/context/VulkanDevice.h"
 #include "Engine/src/renderer/vulkan/memory/VulkanMemory.h"
@@ -16,9 +17,9 @@ class VulkanImage {
 
 private:
     VulkanImage(const VulkanMemory &memory, VkImage image, VmaAllocation imageAllocation,
-                uint32_t width, uint32_t height, VkFormat format)
+                uint32_t width, uint32_t height, VkFormat format, uint32_t mipLevels)
             : memory(memory), image(image), imageAllocation(imageAllocation), width(width), height(height),
-              format(format) {}
+              format(format), mipLevels(mipLevels) {}
 
 public:
     ~VulkanImage() { destroy(); }
@@ -30,7 +31,7 @@ public:
     VulkanImage(VulkanImage &&o) noexcept
             : memory(o.memory), image(std::exchange(o.image, nullptr)),
               imageAllocation(std::exchange(o.imageAllocation, nullptr)),
-              width(o.width), height(o.height), format(o.format) {}
+              width(o.width), height(o.height), format(o.format), mipLevels(o.mipLevels) {}
 
     VulkanImage &operator=(VulkanImage &&o) noexcept {
         if (&o == this)
@@ -41,6 +42,7 @@ public:
         width = o.width;
         height = o.height;
         format = o.format;
+        mipLevels = o.mipLevels;
         return *this;
     }
 
@@ -52,9 +54,32 @@ public:
 
     [[nodiscard]] inline VkFormat getFormat() const { return format; }
 
+    [[nodiscard]] inline uint32_t getMipLevels() const { return mipLevels; }
+
+    [[nodiscard]] inline VkDeviceSize getMemorySize() const { return memory.getAllocationSize(imageAllocation); }
+
 public:
+    /// Creates a texture image, the mip chain is generated with blits on the graphics queue if the format allows it
+    static VulkanImage
+    Create(const VulkanMemory &vulkanMemory, const VulkanCommandPool &graphicsCommandPool,
+           const ChaosEngine::RawImage &image);
+
+    /// Converts the decoded pixels directly into the mapped staging buffer, avoiding intermediate copies
+    static VulkanImage
+    Create(const VulkanMemory &vulkanMemory, const VulkanCommandPool &graphicsCommandPool,
+           const ChaosEngine::DecodedImage &image);
+
+    /// Uploads a block compressed image with its precomputed mip chain
+    static VulkanImage
+    Create(const VulkanMemory &vulkanMemory, const ChaosEngine::CompressedImage &image);
+
+    /**
+     * Copies the mip levels starting at firstLevel into a new smaller image, used to free the memory of the larger
+     * levels. The source MUST have been created with TRANSFER_SRC usage and be in SHADER_READ_ONLY layout.
+     */
     static VulkanImage
-    Create(const VulkanMemory &vulkanMemory, const ChaosEngine::RawImage &image);
+    createMipTail(const VulkanMemory &vulkanMemory, const VulkanCommandPool &graphicsCommandPool,
+                  const VulkanImage &source, uint32_t firstLevel);
 
     static VulkanImage
     createRawImage(const VulkanMemory &vulkanMemory, uint32_t width, uint32_t height, VkFormat format);
@@ -65,15 +90,25 @@ public:
 
     static VkFormat getDepthFormat(const VulkanDevice &device);
 
+    static VkFormat getVkFormat(ChaosEngine::ImageFormat format);
+
+    /// Number of levels of a complete mip chain down to 1x1
+    static uint32_t calculateMipLevels(uint32_t width, uint32_t height);
+
 private:
+    static VulkanImage
+    createFromStagingBuffer(const VulkanMemory &vulkanMemory, const VulkanCommandPool &graphicsCommandPool,
+                            const VulkanBuffer &stagingBuffer, uint32_t width, uint32_t height,
+                            ChaosEngine::ImageFormat format);
 
     static void
     transitionImageLayout(const VulkanMemory &vulkanMemory, VkImage image, VkFormat format, VkImageLayout oldLayout,
-                          VkImageLayout newLayout);
+                          VkImageLayout newLayout, uint32_t mipLevels = 1);
 
-    static bool hasStencilComponent(VkFormat format);
+    /// Fills all levels > 0 by successive blits, expects every level in TRANSFER_DST and leaves them SHADER_READ_ONLY
+    static void generateMipmaps(const VulkanCommandPool &graphicsCommandPool, const VulkanImage &image);
 
-    static VkFormat getVkFormat(ChaosEngine::ImageFormat format);
+    static bool hasStencilComponent(VkFormat format);
 
 private:
     void destroy() {
@@ -88,6 +123,7 @@ private:
     uint32_t width;
     uint32_t height;
     VkFormat format;
+    uint32_t mipLevels;
 };
 
 
@@ -7,7 +7,8 @@
 
 /* Creates an image view for an image. */
 VulkanImageView
-VulkanImageView::Create(const VulkanDevice &device, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags) {
+VulkanImageView::Create(const VulkanDevice &device, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags,
+                        uint32_t mipLevels) {
     VkImageViewCreateInfo createInfo = {};
     createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
     createInfo.image = image;
@@ -19,7 +20,7 @@ VulkanImageView::Create(const VulkanDevice &device, VkImage image, VkFormat form
     createInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
     createInfo.subresourceRange.aspectMask = aspectFlags;
     createInfo.subresourceRange.baseMipLevel = 0;
-    createInfo.subresourceRange.levelCount = 1;
+    createInfo.subresourceRange.levelCount = mipLevels;
     createInfo.subresourceRange.baseArrayLayer = 0;
     createInfo.subresourceRange.layerCount = 1;
 
@@ -24,7 +24,8 @@ public:
     VulkanImageView &operator=(VulkanImageView &&o) noexcept;
 
     static VulkanImageView
-    Create(const VulkanDevice &device, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags);
+    Create(const VulkanDevice &device, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags,
+           uint32_t mipLevels = 1);
 
     [[nodiscard]] inline VkImageView vk() const { return imageView; }
 
@@ -2,7 +2,7 @@
 
 #include <stdexcept>
 
-VulkanSampler VulkanSampler::create(const VulkanDevice &device, VkFilter filter) {
+VulkanSampler VulkanSampler::create(const VulkanDevice &device, VkFilter filter, uint32_t mipLevels) {
     VkSamplerCreateInfo samplerInfo = {};
     samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
     // Configure filtering
@@ -23,7 +23,7 @@ VulkanSampler VulkanSampler::create(const VulkanDevice &device, VkFilter filter)
     samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
     samplerInfo.mipLodBias = 0.0f;
     samplerInfo.minLod = 0.0f;
-    samplerInfo.maxLod = 0.0f;
+    samplerInfo.maxLod = static_cast<float>(mipLevels);
 
     VkSampler sampler = {};
     if (vkCreateSampler(device.vk(), &samplerInfo, nullptr, &sampler) != VK_SUCCESS) {
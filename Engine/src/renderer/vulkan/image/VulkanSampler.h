@@ -28,7 +28,7 @@ public:
         return *this;
     }
 
-    static VulkanSampler create(const VulkanDevice &device, VkFilter filter = VK_FILTER_LINEAR);
+    static VulkanSampler create(const VulkanDevice &device, VkFilter filter = VK_FILTER_LINEAR, uint32_t mipLevels = 1);
 
     [[nodiscard]] inline VkSampler vk() const { return sampler; }
 
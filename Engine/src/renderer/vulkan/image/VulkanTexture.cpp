@@ -1,20 +1,43 @@
 #include "VulkanTexture.h"
 
+#include <algorithm>
+#include <type_traits>
 #include <utility>
 
 #include "VulkanSampler.h"
 
 #include "VulkanImage.h"
+#include "Engine/src/core/renderSystem/RenderingSystem.h"
 
 VulkanTexture
 VulkanTexture::Create(const VulkanContext &context, const ChaosEngine::RawImage &rawImage,
                       const std::optional<std::string> &debugName) {
-    auto image = VulkanImage::Create(context.getMemory(), rawImage);
+    return CreateFromImage(context, VulkanImage::Create(context.getMemory(), context.getGraphicsCommandPool(), rawImage),
+                           debugName);
+}
+
+VulkanTexture
+VulkanTexture::Create(const VulkanContext &context, const ChaosEngine::DecodedImage &decodedImage,
+                      const std::optional<std::string> &debugName) {
+    return CreateFromImage(context,
+                           VulkanImage::Create(context.getMemory(), context.getGraphicsCommandPool(), decodedImage),
+                           debugName);
+}
+
+VulkanTexture
+VulkanTexture::Create(const VulkanContext &context, const ChaosEngine::CompressedImage &compressedImage,
+                      const std::optional<std::string> &debugName) {
+    return CreateFromImage(context, VulkanImage::Create(context.getMemory(), compressedImage), debugName);
+}
+
+VulkanTexture
+VulkanTexture::CreateFromImage(const VulkanContext &context, VulkanImage &&image,
+                               const std::optional<std::string> &debugName) {
     VulkanImageView imageView = VulkanImageView::Create(context.getDevice(), image.vk(), image.getFormat(),
-                                                        VK_IMAGE_ASPECT_COLOR_BIT);
+                                                        VK_IMAGE_ASPECT_COLOR_BIT, image.getMipLevels());
     context.setDebugName(VK_OBJECT_TYPE_IMAGE_VIEW, (uint64_t) imageView.vk(), debugName);
 
-    VulkanSampler sampler = VulkanSampler::create(context.getDevice());
+    VulkanSampler sampler = VulkanSampler::create(context.getDevice(), VK_FILTER_LINEAR, image.getMipLevels());
 
     return VulkanTexture{context.getDevice(), std::make_shared<VulkanImage>(std::move(image)),
                          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, std::move(imageView), std::move(sampler)};
@@ -31,12 +54,13 @@ VulkanTexture::VulkanTexture(const VulkanDevice &device, std::shared_ptr<VulkanI
           sampler(std::move(sampler)), imageLayout(imageLayout) {}
 
 VulkanTexture::VulkanTexture(VulkanTexture &&o) noexcept
-        : device(o.device), image(std::move(o.image)), imageView(std::move(o.imageView)), imageViewVk(o.imageViewVk),
-          sampler(std::move(o.sampler)), imageLayout(o.imageLayout) {}
+        : Texture(o), device(o.device), image(std::move(o.image)), imageView(std::move(o.imageView)),
+          imageViewVk(o.imageViewVk), sampler(std::move(o.sampler)), imageLayout(o.imageLayout) {}
 
 VulkanTexture &VulkanTexture::operator=(VulkanTexture &&o) noexcept {
     if (this == &o)
         return *this;
+    Texture::operator=(o);
     image = std::move(o.image);
     imageView = std::move(o.imageView);
     sampler = std::move(o.sampler);
@@ -44,3 +68,54 @@ VulkanTexture &VulkanTexture::operator=(VulkanTexture &&o) noexcept {
     return *this;
 }
 
+
+// ------------------------------------ Residency ----------------------------------------------------------------------
+
+uint64_t VulkanTexture::getMemorySize() const {
+    // Reference textures do not own their memory
+    return imageView ? image->getMemorySize() : 0;
+}
+
+uint32_t VulkanTexture::getMipTailLevel(uint32_t maxExtent) const {
+    for (uint32_t level = 1; level < image->getMipLevels(); ++level) {
+        if (std::max(image->getWidth() >> level, image->getHeight() >> level) <= maxExtent)
+            return level;
+    }
+    return 0;
+}
+
+bool VulkanTexture::canEvict(uint32_t maxExtent) const {
+    return imageView && !evicted && getMipTailLevel(maxExtent) > 0;
+}
+
+void VulkanTexture::evict(uint32_t maxExtent) {
+    assert("Texture can not be evicted!" && canEvict(maxExtent));
+    const auto &context = dynamic_cast<const VulkanContext &>(ChaosEngine::RenderingSystem::GetContext());
+    replaceImage(context, VulkanImage::createMipTail(context.getMemory(), context.getGraphicsCommandPool(), *image,
+                                                     getMipTailLevel(maxExtent)));
+    evicted = true;
+}
+
+void VulkanTexture::restore(SourceImage &&sourceImage) {
+    assert("Only evicted textures can be restored!" && evicted);
+    const auto &context = dynamic_cast<const VulkanContext &>(ChaosEngine::RenderingSystem::GetContext());
+    std::visit([&](const auto &loadedImage) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(loadedImage)>, ChaosEngine::CompressedImage>) {
+            replaceImage(context, VulkanImage::Create(context.getMemory(), loadedImage));
+        } else {
+            replaceImage(context,
+                         VulkanImage::Create(context.getMemory(), context.getGraphicsCommandPool(), loadedImage));
+        }
+    }, sourceImage);
+    evicted = false;
+}
+
+void VulkanTexture::replaceImage(const VulkanContext &context, VulkanImage &&newImage) {
+    imageView = VulkanImageView::Create(context.getDevice(), newImage.vk(), newImage.getFormat(),
+                                        VK_IMAGE_ASPECT_COLOR_BIT, newImage.getMipLevels());
+    if (source)
+        context.setDebugName(VK_OBJECT_TYPE_IMAGE_VIEW, (uint64_t) imageView->vk(), "textures/" + source->filename);
+    sampler = VulkanSampler::create(context.getDevice(), VK_FILTER_LINEAR, newImage.getMipLevels());
+    image = std::make_shared<VulkanImage>(std::move(newImage));
+    ++generation;
+}
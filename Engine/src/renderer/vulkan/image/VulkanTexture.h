@@ -33,6 +33,13 @@ public:
     Create(const VulkanContext &context, const ChaosEngine::RawImage &rawImage,
            const std::optional<std::string> &debugName = std::nullopt);
 
+    static VulkanTexture
+    Create(const VulkanContext &context, const ChaosEngine::DecodedImage &decodedImage,
+           const std::optional<std::string> &debugName = std::nullopt);
+
+    static VulkanTexture
+    Create(const VulkanContext &context, const ChaosEngine::CompressedImage &compressedImage,
+           const std::optional<std::string> &debugName = std::nullopt);
 
     inline VkImageView getImageView() const { return imageView ? imageView->vk() : *imageViewVk; }
 
@@ -40,6 +47,26 @@ public:
 
     inline VkImageLayout getImageLayout() const { return imageLayout; }
 
+// ------------------------------------ Residency ----------------------------------------------------------------------
+
+    [[nodiscard]] uint64_t getMemorySize() const override;
+
+    [[nodiscard]] bool canEvict(uint32_t maxExtent) const override;
+
+    void evict(uint32_t maxExtent) override;
+
+    void restore(SourceImage &&sourceImage) override;
+
+private:
+    static VulkanTexture
+    CreateFromImage(const VulkanContext &context, VulkanImage &&image, const std::optional<std::string> &debugName);
+
+    /// First mip level whose extent is no larger than maxExtent, 0 if there is none
+    [[nodiscard]] uint32_t getMipTailLevel(uint32_t maxExtent) const;
+
+    /// Swaps in a new image with a matching view and sampler, the previous resources are destroyed immediately
+    void replaceImage(const VulkanContext &context, VulkanImage &&newImage);
+
 private:
     const VulkanDevice &device;
     std::shared_ptr<VulkanImage> image;
@@ -119,6 +119,14 @@ void VulkanMemory::copyBufferToImage(const VulkanBuffer &buffer, const VulkanIma
     });
 }
 
+void VulkanMemory::copyBufferToImage(const VulkanBuffer &buffer, const VulkanImage &image,
+                                     const std::vector<VkBufferImageCopy> &regions) const {
+    commandPool.runInSingeTimeCommandBuffer([&](VkCommandBuffer commandBuffer) {
+        vkCmdCopyBufferToImage(commandBuffer, buffer.vk(), image.vk(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<uint32_t>(regions.size()), regions.data());
+    });
+}
+
 VulkanUniformBuffer
 VulkanMemory::createUniformBuffer(uint32_t elementSize, uint32_t count, bool aligned) const {
     VkDeviceSize uboSize = (long) elementSize * count;
@@ -171,8 +179,8 @@ VulkanBuffer VulkanMemory::createStreamingBuffer(VkDeviceSize size, const void *
 }
 
 VulkanImage VulkanMemory::createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling,
-                                      VkImageUsageFlags usage, VmaMemoryUsage memoryUsage, bool dedicatedAllocation)
-const {
+                                      VkImageUsageFlags usage, VmaMemoryUsage memoryUsage, bool dedicatedAllocation,
+                                      uint32_t mipLevels) const {
     // Create the image
     VkImageCreateInfo imageInfo = {};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -180,7 +188,7 @@ const {
     imageInfo.extent.width = width;
     imageInfo.extent.height = height;
     imageInfo.extent.depth = 1; // 1 layer -> 2D
-    imageInfo.mipLevels = 1;
+    imageInfo.mipLevels = mipLevels;
     imageInfo.arrayLayers = 1;
     imageInfo.format = format; // must be corresponding to the data
     imageInfo.tiling = tiling; // usage optimized layout
@@ -213,7 +221,8 @@ const {
         throw std::runtime_error(std::string("[VMA] Failed to create Image! Error code: ") + std::to_string(res));
     }
 
-    return VulkanImage{*this, image, allocation, static_cast<uint32_t>(width), static_cast<uint32_t>(height), format};
+    return VulkanImage{*this, image, allocation, static_cast<uint32_t>(width), static_cast<uint32_t>(height), format,
+                       mipLevels};
 }
 
 // ------------------------------------- Mapping -----------------------------------------------------------------------
@@ -228,6 +237,12 @@ void VulkanMemory::unmapBuffer(const VmaAllocation &allocation) const {
     vmaUnmapMemory(allocator, allocation);
 }
 
+VkDeviceSize VulkanMemory::getAllocationSize(const VmaAllocation &allocation) const {
+    VmaAllocationInfo allocationInfo{};
+    vmaGetAllocationInfo(allocator, allocation, &allocationInfo);
+    return allocationInfo.size;
+}
+
 // --------------------------------- Resource Destruction --------------------------------------------------------------
 
 void VulkanMemory::destroyImage(VkImage image, VmaAllocation imageAllocation) const {
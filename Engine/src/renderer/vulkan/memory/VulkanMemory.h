@@ -3,6 +3,8 @@
 #include <vulkan/vulkan.h>
 #include <vk_mem_alloc.h>
 
+#include <vector>
+
 class VulkanContext;
 
 class VulkanDevice;
@@ -49,7 +51,8 @@ public:
 
     [[nodiscard]] VulkanImage
     createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling,
-                VkImageUsageFlags usage, VmaMemoryUsage memoryUsage, bool dedicatedAllocation = false) const;
+                VkImageUsageFlags usage, VmaMemoryUsage memoryUsage, bool dedicatedAllocation = false,
+                uint32_t mipLevels = 1) const;
 
 // ------------------------------------ Update Methods -----------------------------------------------------------------
     void
@@ -57,6 +60,10 @@ public:
 
     void copyBufferToImage(const VulkanBuffer &buffer, const VulkanImage &image, uint32_t width, uint32_t height) const;
 
+    /// Copies multiple regions e.g. a complete mip chain in one submission
+    void copyBufferToImage(const VulkanBuffer &buffer, const VulkanImage &image,
+                           const std::vector<VkBufferImageCopy> &regions) const;
+
 // ---------------------------------- Destruction Methods --------------------------------------------------------------
 
     void destroyImage(VkImage image, VmaAllocation imageAllocation) const;
@@ -69,6 +76,8 @@ public:
 
     void unmapBuffer(const VmaAllocation &allocation) const;
 
+    [[nodiscard]] VkDeviceSize getAllocationSize(const VmaAllocation &allocation) const;
+
 // ------------------------------------- Helpers -----------------------------------------------------------------------
 
     /// Calculates required size with alignment based on minimum device offset alignment
@@ -76,6 +85,8 @@ public:
 
     [[nodiscard]] const VulkanCommandPool &getTransferCommandPool() const { return commandPool; }
 
+    [[nodiscard]] const VulkanDevice &getDevice() const { return device; }
+
 private:
     void copyBuffer(const VulkanBuffer &srcBuffer, const VulkanBuffer &dstBuffer, VkDeviceSize size) const;
 
@@ -3,9 +3,9 @@
 #include "Engine/src/renderer/vulkan/context/VulkanDevice.h"
 #include "Engine/src/renderer/vulkan/rendering/VulkanRenderPass.h"
 #include "VulkanPipeline.h"
+#include "Engine/src/core/assets/AssetLoader.h"
 
 #include <stdexcept>
-#include <fstream>
 #include <cassert>
 
 using namespace Renderer;
@@ -27,25 +27,6 @@ static VkShaderModule createShaderModule(const VulkanDevice &device, const std::
     return shaderModule;
 }
 
-/* Reads a file from 'filename' and returns it in bytes. */
-static std::vector<char> readFile(const std::string &filename) {
-    std::ifstream file(filename, std::ios::ate | std::ios::binary);
-
-    if (!file.is_open()) {
-        throw std::runtime_error("[Vulkan] Failed to open file! " + filename);
-    }
-
-    size_t fileSize = (size_t) file.tellg();
-    std::vector<char> buffer(fileSize);
-
-    file.seekg(0);
-    file.read(buffer.data(), fileSize);
-
-    file.close();
-
-    return buffer;
-}
-
 // ------------------------------------ Class Members ------------------------------------------------------------------
 
 VulkanPipeline VulkanPipelineBuilder::build() {
@@ -54,11 +35,10 @@ VulkanPipeline VulkanPipelineBuilder::build() {
     assert(!fragmentShaderName.empty());
 
     // Create shader objects -------------------------------------------------------------------------------------------
-    // TODO: Load from asset manager
     std::string vShaderName = "shaders/" + vertexShaderName + ".vert.spv";
     std::string fShaderName = "shaders/" + fragmentShaderName + ".frag.spv";
-    auto vertShaderCode = readFile(vShaderName);
-    auto fragShaderCode = readFile(fShaderName);
+    auto vertShaderCode = ChaosEngine::AssetLoader::loadBinary(vShaderName);
+    auto fragShaderCode = ChaosEngine::AssetLoader::loadBinary(fShaderName);
 
     VkShaderModule vertShaderModule = createShaderModule(device, vertShaderCode, vShaderName);
     VkShaderModule fragShaderModule = createShaderModule(device, fragShaderCode, fShaderName);
@@ -46,6 +46,10 @@ VkFormat VertexAttributeBuilder::getVkFormat(Renderer::VertexFormat format) {
             return VK_FORMAT_R32G32B32_SFLOAT;
         case VertexFormat::RGBA_FLOAT:
             return VK_FORMAT_R32G32B32A32_SFLOAT;
+        case VertexFormat::RG_HALF:
+            return VK_FORMAT_R16G16_SFLOAT;
+        case VertexFormat::RGBA_UNORM8:
+            return VK_FORMAT_R8G8B8A8_UNORM;
     }
     assert("Unknown Vertex Format" && false);
     return VK_FORMAT_R32_SFLOAT;
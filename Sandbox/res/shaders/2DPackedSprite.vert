@@ -0,0 +1,33 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+// Packed 2D vertex, half float position and UVs with a normalized RGBA color
+layout(location = 0) in vec2 in_Position;
+layout(location = 1) in vec4 in_Color;
+layout(location = 2) in vec2 in_UVs;
+
+layout(location = 0) out vec3 out_fragColor;
+layout(location = 1) out vec3 out_fragNormal;
+layout(location = 2) out vec2 out_fragUVs;
+layout(location = 3) out vec3 out_fragWorldPos;
+
+layout(set = 0, binding = 0) uniform UniformBufferObject {
+    mat4 view;
+    mat4 proj;
+} cameraUbo;
+
+layout(push_constant) uniform ModelData {
+    layout(offset = 0) vec4 linear; // Column major 2x2 rotation and scale
+    layout(offset = 16) vec4 translation; // x, y and depth
+} modelData;
+
+void main() {
+    out_fragColor = in_Color.rgb;
+    // Sprites always face the camera
+    out_fragNormal = vec3(0.0, 0.0, 1.0);
+    out_fragUVs = in_UVs;
+    mat2 linear = mat2(modelData.linear.xy, modelData.linear.zw);
+    vec4 position = vec4(linear * in_Position + modelData.translation.xy, modelData.translation.z, 1.0);
+    out_fragWorldPos = position.xyz;
+    gl_Position = cameraUbo.proj * cameraUbo.view * position;
+}
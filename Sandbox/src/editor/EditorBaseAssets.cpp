@@ -2,6 +2,7 @@
 
 #include "core/utils/Logger.h"
 #include "core/assets/ModelLoader.h"
+#include "core/assets/MeshOptimizer.h"
 
 #include "scripts/BaseMovementScript.h"
 #include "scripts/ButtonScript.h"
@@ -30,6 +31,12 @@ void EditorBaseAssets::loadBaseMeshes() {
     hexROB = RenderMesh::Create(std::move(hexVertexBuffer), std::move(hexIndexBuffer), hexAsset.indices.size());
     assetManager.registerMesh("Hex", hexROB, AssetManager::MeshInfo{});
 
+    LOG_INFO("Creating packed quad buffers");
+    // Only usable with materials using the packed 2D vertex layout
+    auto packedQuadROB = RenderMesh::Create(packMesh2D(
+            MeshOptimizer::optimize(ModelLoader::getQuad_PNCU(), MeshOptimizer::Options{.lodCount = 1})));
+    assetManager.registerMesh("Quad/Packed", std::move(packedQuadROB), AssetManager::MeshInfo{});
+
 
     LOG_INFO("Creating UI quad buffers");
     auto uiQuadAsset = ModelLoader::getQuad_PCU();
@@ -99,6 +106,36 @@ void EditorBaseAssets::loadBaseMaterials() {
     });
     assetManager.registerMaterial("TexturedSprite", texturedMaterial, AssetManager::MaterialInfo{.hasTintColor=true});
 
+    auto packedTexturedMaterial = Material::Create(MaterialCreateInfo{
+            .stage = ShaderPassStage::Opaque,
+            .vertexLayout = VertexLayout{.binding = 0, .stride = sizeof(VertexPacked2D), .inputRate=InputRate::Vertex,
+                    .attributes = std::vector<VertexAttribute>(
+                            {
+                                    VertexAttribute{0, VertexFormat::RG_HALF, offsetof(VertexPacked2D, pos)},
+                                    VertexAttribute{1, VertexFormat::RGBA_UNORM8, offsetof(VertexPacked2D, color)},
+                                    VertexAttribute{2, VertexFormat::RG_HALF, offsetof(VertexPacked2D, uv)},
+                            })},
+            .fixedFunction = FixedFunctionConfiguration{.depthTest = true, .depthWrite = true},
+            .vertexShader = "2DPackedSprite",
+            .fragmentShader = "2DStaticTexturedSprite",
+            .pushConstant = std::make_optional(Material::StandardOpaquePushConstants),
+            .set0 = std::make_optional(Material::StandardOpaqueSet0),
+            .set0ExpectedCount = Material::StandardOpaqueSet0ExpectedCount,
+            .set1 = std::make_optional(std::vector<ShaderBindings>(
+                    {ShaderBindings{.type = ShaderBindingType::TextureSampler, .stage=ShaderStage::Fragment, .name="diffuseTexture"},
+                     ShaderBindings{.type = ShaderBindingType::UniformBuffer, .stage=ShaderStage::Fragment, .name="materialData",
+                             .layout=std::make_optional(std::vector<ShaderBindingLayout>(
+                                     {
+                                             ShaderBindingLayout{.type = ShaderValueType::Vec4, .name ="color"},
+                                     }))
+                     }
+                    })),
+            .set1ExpectedCount = 64,
+            .name="PackedTexturedSprite",
+    });
+    assetManager.registerMaterial("PackedTexturedSprite", packedTexturedMaterial,
+                                  AssetManager::MaterialInfo{.hasTintColor=true});
+
     auto uiMaterial = Material::Create(MaterialCreateInfo{
             .stage = ShaderPassStage::Opaque,
             .vertexLayout = VertexLayout{.binding = 0, .stride = sizeof(VertexPCU), .inputRate=InputRate::Vertex,
@@ -133,14 +170,14 @@ void EditorBaseAssets::loadBaseMaterials() {
 }
 
 void EditorBaseAssets::loadBaseTextures() {
-    auto fallbackTexture1 = Texture::Create("TestAtlas.jpg");
-    fallbackTexture = assetManager.registerTexture("TestAtlas.jpg", std::move(fallbackTexture1),
+    auto textures = Texture::CreateBatch({{"TestAtlas.jpg",   ImageFormat::R8G8B8A8},
+                                          {"Border_128.png",  ImageFormat::R8G8B8A8},
+                                          {"OBorder_128.png", ImageFormat::R8G8B8A8}});
+    fallbackTexture = assetManager.registerTexture("TestAtlas.jpg", std::move(textures[0]),
                                                    AssetManager::TextureInfo{});
 
-    auto borderTexture = Texture::Create("Border_128.png");
-    assetManager.registerTexture("UI/Border", std::move(borderTexture), AssetManager::TextureInfo{});
-    auto oBorderTexture = Texture::Create("OBorder_128.png");
-    assetManager.registerTexture("UI/OBorder", std::move(oBorderTexture), AssetManager::TextureInfo{});
+    assetManager.registerTexture("UI/Border", std::move(textures[1]), AssetManager::TextureInfo{});
+    assetManager.registerTexture("UI/OBorder", std::move(textures[2]), AssetManager::TextureInfo{});
 }
 
 void EditorBaseAssets::loadBaseScripts() {
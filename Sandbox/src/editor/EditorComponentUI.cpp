@@ -215,9 +215,12 @@ void EditorComponentUI::renderMetaComponentUI(ChaosEngine::Entity &entity) {
 
 void EditorComponentUI::renderTransformComponentUI(ChaosEngine::Entity &entity) {
     auto &tc = entity.get<Transform>();
-    ImGui::DragFloat3("Position", &(tc.position.x), 0.25f * dragSpeed);
-    ImGui::DragFloat3("Rotation", &(tc.rotation.x), 1.0f * dragSpeed);
-    ImGui::DragFloat3("Scale", &(tc.scale.x), 0.25f * dragSpeed);
+    bool changed = ImGui::DragFloat3("Position", &(tc.position.x), 0.25f * dragSpeed);
+    changed |= ImGui::DragFloat3("Rotation", &(tc.rotation.x), 1.0f * dragSpeed);
+    changed |= ImGui::DragFloat3("Scale", &(tc.scale.x), 0.25f * dragSpeed);
+    // Notifies change trackers of the edit
+    if (changed)
+        entity.patch<Transform>();
 }
 
 void EditorComponentUI::renderCameraComponentUI(ChaosEngine::Entity &entity) {
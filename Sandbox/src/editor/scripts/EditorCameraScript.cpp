@@ -24,7 +24,7 @@ void EditorCameraScript::onUpdate(float deltaTime) {
         getComponent<CameraComponent>().fieldOfView += 5 * deltaTime;
     }
 
-    getComponent<Transform>().position = origin;
+    patchComponent<Transform>([this](auto &transform) { transform.position = origin; });
 }
 
 void EditorCameraScript::setActive(bool b) {
@@ -186,7 +186,7 @@ void TestScene::update(float deltaTime) {
             editorCamera.get<CameraComponent>().fieldOfView += 5 * deltaTime;
         }
 
-        editorCamera.get<Transform>().position = origin;
+        editorCamera.patch<Transform>([](auto &transform) { transform.position = origin; });
     }
 
 }
@@ -302,9 +302,11 @@ void TestScene::updateImGui() {
                     ImGui::Separator();
 
                     auto &tc = entity.get<Transform>();
-                    ImGui::DragFloat3("Position", &(tc.position.x), 0.25f * dragSpeed);
-                    ImGui::DragFloat3("Rotation", &(tc.rotation.x), 1.0f * dragSpeed);
-                    ImGui::DragFloat3("Scale", &(tc.scale.x), 0.25f * dragSpeed);
+                    bool changed = ImGui::DragFloat3("Position", &(tc.position.x), 0.25f * dragSpeed);
+                    changed |= ImGui::DragFloat3("Rotation", &(tc.rotation.x), 1.0f * dragSpeed);
+                    changed |= ImGui::DragFloat3("Scale", &(tc.scale.x), 0.25f * dragSpeed);
+                    if (changed)
+                        entity.patch<Transform>();
                     ImGui::Separator();
                     ImGui::ColorEdit4("Color", &(editTintColor.r));
                     if (ImGui::Button("Apply")) {
@@ -86,14 +86,14 @@ void Box2DTestScene::load() {
 
     LOG_INFO("Loading base textures");
 
-    auto fallbackTex = Texture::Create("TestAtlas.jpg");
-    assetManager->registerTexture("TestAtlas.jpg", std::move(fallbackTex),
+    auto textures = Texture::CreateBatch({{"TestAtlas.jpg", ImageFormat::R8G8B8A8},
+                                          {"noTex.jpg",     ImageFormat::R8G8B8A8},
+                                          {"ball.png",      ImageFormat::R8G8B8A8}});
+    assetManager->registerTexture("TestAtlas.jpg", std::move(textures[0]),
                                   AssetManager::TextureInfo{});
-    auto plainTex = Texture::Create("noTex.jpg");
-    assetManager->registerTexture("Square", std::move(plainTex),
+    assetManager->registerTexture("Square", std::move(textures[1]),
                                   AssetManager::TextureInfo{});
-    auto ballTex = Texture::Create("ball.png");
-    assetManager->registerTexture("ball", std::move(ballTex),
+    assetManager->registerTexture("ball", std::move(textures[2]),
                                   AssetManager::TextureInfo{});
 
     LOG_INFO("Loading base font");
@@ -20,5 +20,5 @@ void CameraScript::onUpdate(float deltaTime) {
         getComponent<CameraComponent>().fieldOfView += 5 * deltaTime;
     }
 
-    getComponent<Transform>().position = origin;
+    patchComponent<Transform>([this](auto &transform) { transform.position = origin; });
 }
@@ -0,0 +1,96 @@
+#include "Engine/src/core/Components.h"
+
+#include <entt/entity/registry.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/**
+ * Compares the draw loop of the RenderingSystem, which iterates the owning group of WorldMatrixComponent and
+ * RenderComponent, with the non-owning view it used before. Both registries hold the same entities, only the first one
+ * has the group, so the view walks sparse sets in creation order and looks the other component up for every entity.
+ */
+
+namespace {
+
+    constexpr size_t entityCount = 200000;
+    constexpr int frames = 50;
+
+    /// Fills the registry like a running scene, the same seed gives every registry the same entities
+    void populate(entt::registry &registry) {
+        std::mt19937 random(1337);
+        std::vector<entt::entity> entities(entityCount);
+        registry.create(entities.begin(), entities.end());
+        for (auto entity: entities) {
+            registry.emplace<Transform>(entity);
+        }
+        // Drawables are added in random order and some entities are removed again
+        std::shuffle(entities.begin(), entities.end(), random);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (i % 4 == 3)
+                continue;
+            auto &world = registry.emplace<WorldMatrixComponent>(entities[i]);
+            world.matrix.translation.x = static_cast<float>(i);
+            world.generation = static_cast<uint32_t>(i);
+            registry.emplace<RenderComponent>(entities[i], nullptr, nullptr);
+        }
+        for (size_t i = 0; i < entities.size(); i += 7) {
+            registry.destroy(entities[i]);
+        }
+    }
+
+    /// Reads what the RenderingSystem reads for every draw
+    float draw(const WorldMatrixComponent &world, const RenderComponent &render) {
+        return world.matrix.translation.x + static_cast<float>(render.mesh == nullptr) +
+               static_cast<float>(render.materialInstance == nullptr);
+    }
+
+    template<typename Function>
+    double nanosecondsPerEntity(size_t entities, Function &&function) {
+        double best = 1e30;
+        for (int frame = 0; frame < frames; ++frame) {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+            best = std::min(best, duration.count());
+        }
+        return best / static_cast<double>(entities);
+    }
+
+}
+
+int main() {
+    entt::registry grouped, ungrouped;
+    populate(grouped);
+    populate(ungrouped);
+
+    auto group = grouped.group<WorldMatrixComponent, RenderComponent>();
+    const auto view = ungrouped.view<const WorldMatrixComponent, const RenderComponent>();
+    const size_t drawables = group.size();
+    volatile float sink = 0;
+
+    const double viewTime = nanosecondsPerEntity(drawables, [&]() {
+        float sum = 0;
+        view.each([&sum](const WorldMatrixComponent &world, const RenderComponent &render) {
+            sum += draw(world, render);
+        });
+        sink = sum;
+    });
+
+    const double groupTime = nanosecondsPerEntity(drawables, [&]() {
+        float sum = 0;
+        for (const auto &[entity, world, render]: group.each()) {
+            sum += draw(world, render);
+        }
+        sink = sum;
+    });
+
+    std::printf("%zu drawables, best of %d frames\n", drawables, frames);
+    std::printf("ungrouped view:  %6.2f ns per entity\n", viewTime);
+    std::printf("owning group:    %6.2f ns per entity\n", groupTime);
+    std::printf("speedup:         %6.2fx\n", viewTime / groupTime);
+    return 0;
+}
@@ -19,15 +19,17 @@ layout(set = 0, binding = 0) uniform UniformBufferObject {
 
 // Per Object data
 layout(push_constant) uniform ModelData {
-    layout(offset = 0) mat4 modelMat;
+    layout(offset = 0) vec4 linear; // Column major 2x2 rotation and scale
+    layout(offset = 16) vec4 translation; // x, y and depth
 } modelData;
 
 void main() {
     out_fragColor = in_Color;
+    mat2 linear = mat2(modelData.linear.xy, modelData.linear.zw);
     // We only want the rotation effect of the model matrix, scale can be ignored
-    out_fragNormal = normalize(mat3(transpose(inverse(modelData.modelMat))) * in_Normal);
+    out_fragNormal = normalize(vec3(transpose(inverse(linear)) * in_Normal.xy, in_Normal.z));
     out_fragUVs = in_UVs;
-    vec4 position = modelData.modelMat * vec4(in_Position, 1.0);
+    vec4 position = vec4(linear * in_Position.xy + modelData.translation.xy, in_Position.z + modelData.translation.z, 1.0);
     out_fragWorldPos = position.xyz;
     gl_Position = cameraUbo.proj * cameraUbo.view * position;
 }
@@ -137,7 +137,6 @@ void SoundTestScene::load() {
     assetManager->loadFont("OpenSauceSans", "fonts/OpenSauceSans-Bold.ttf",
                            FontStyle::Bold, 16.0f, 95.0f);
 
-    backgroundAudioBuffer = AudioBuffer::Create("sounds/background.ogg");
     stepsAudioBuffer = AudioBuffer::Create("sounds/steps.ogg");
 
     loadEntities();
@@ -170,7 +169,8 @@ void SoundTestScene::loadEntities() {
     mainCamera.setComponent<AudioSourceComponent>(
             std::move(backgroundAudioSource),
             mainCameraTransform.position);
-    mainCamera.get<AudioSourceComponent>().source.setBuffer(backgroundAudioBuffer);
+    // Music is streamed instead of being decoded completely up front
+    mainCamera.get<AudioSourceComponent>().source.setStream(AudioStream::Open("sounds/background.ogg"));
 
     const glm::vec4 whiteColor(1, 1, 1, 1);
     const glm::vec4 redColor(1, 0, 0, 1);
@@ -255,7 +255,7 @@ void SoundTestScene::update(float deltaTime) {
         const auto &center = mainCamera.get<Transform>().position;
         path += deltaTime * surroundSpeed;
         glm::vec3 newPos = glm::rotate(glm::qua(glm::vec3{0, path, 0}), surroundOriginalPosition - center) + center;
-        audioTesterSurround.get<Transform>().position = newPos;
+        audioTesterSurround.patch<Transform>([&newPos](auto &transform) { transform.position = newPos; });
 //        LOG_DEBUG("New position ({}, {}, {})", newPos.x, newPos.y, newPos.z);
     }
 }
@@ -278,6 +278,8 @@ void SoundTestScene::updateImGui() {
     Transform listenerInfo = AudioSystem::GetListenerPosition();
     ImGui::Text("Listener Position (%.2f, %.2f, %.2f)", listenerInfo.position.x, listenerInfo.position.y,
                 listenerInfo.position.z);
+    if (const auto *audioThread = AudioSystem::GetAudioThread())
+        ImGui::Text("Voices %u / %u", audioThread->getActiveVoiceCount(), audioThread->getVoiceCount());
     const auto &surroundTesterPos = audioTesterSurround.get<Transform>().position;
     ImGui::Text("Surround position (%.2f, %.2f, %.2f)", surroundTesterPos.x, surroundTesterPos.y, surroundTesterPos.z);
     for (uint32_t i = 0; i < spatialTesters.size(); ++i) {
@@ -313,23 +315,20 @@ void SoundTestScene::updateImGui() {
     ImGui::NextColumn();
 
     ImGui::Separator();
-    const auto &bgBuffer = bgAudioSource.getBuffer();
-    const auto sourcePos = bgAudioSource.getBufferPosition() / bgBuffer.getSampleSize();
-    const auto bufferLength = bgBuffer.getSamples() * bgBuffer.getSampleSize();
-    const float totalSeconds = (float) ((bgBuffer.getSamples() / bgBuffer.getSampleRate()));
+    const auto &bgStream = bgAudioSource.getStream();
+    const auto sourcePos = bgAudioSource.getStreamPosition();
+    const float sampleRate = (float) bgStream.getSampleRate();
     ImGui::Text("Time:");
     ImGui::NextColumn();
-    ImGui::Text("%.1fs /%.1fs",
-                totalSeconds * (((float) sourcePos / (float) bgBuffer.getSamples()) / bgBuffer.getChannels()),
-                totalSeconds);
+    ImGui::Text("%.1fs /%.1fs", (float) sourcePos / sampleRate, (float) bgStream.getLength() / sampleRate);
     ImGui::NextColumn();
-    ImGui::Text("BG buffer offset:");
+    ImGui::Text("BG stream offset:");
     ImGui::NextColumn();
     ImGui::Text("%u", sourcePos);
     ImGui::NextColumn();
-    ImGui::Text("BG buffer length:");
+    ImGui::Text("BG stream length:");
     ImGui::NextColumn();
-    ImGui::Text("%u", bufferLength);
+    ImGui::Text("%u", bgStream.getLength());
     ImGui::NextColumn();
 
     ImGui::Columns(1);
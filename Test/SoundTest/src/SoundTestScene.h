@@ -25,7 +25,6 @@ private:
 
     std::shared_ptr<Renderer::RenderMesh> quadROB = nullptr;
     Renderer::MaterialRef texturedMaterial  = Renderer::MaterialRef(nullptr);
-    std::shared_ptr<ChaosEngine::AudioBuffer> backgroundAudioBuffer = nullptr;
     std::shared_ptr<ChaosEngine::AudioBuffer> stepsAudioBuffer = nullptr;
 
     ChaosEngine::Entity mainCamera;
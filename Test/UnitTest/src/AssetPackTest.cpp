@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/assets/AssetPack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    std::string tempPackPath(const std::string &name) {
+        return (std::filesystem::temp_directory_path() / ("ChaosEngineUnitTest_" + name + ".pack")).string();
+    }
+
+    std::vector<char> toBytes(const std::string &text) {
+        return {text.begin(), text.end()};
+    }
+
+    std::vector<char> randomBytes(size_t size, uint32_t seed) {
+        std::mt19937 random(seed);
+        std::vector<char> data(size);
+        for (auto &byte: data) {
+            byte = static_cast<char>(random());
+        }
+        return data;
+    }
+
+}
+
+TEST(AssetPackTest, RoundTripsCompressedAndUncompressedEntries) {
+    std::string repetitive;
+    for (int i = 0; i < 1000; ++i) {
+        repetitive += "layout(location = 0) in vec2 position; // " + std::to_string(i % 10) + "\n";
+    }
+    const auto compressible = toBytes(repetitive);
+    const auto incompressible = randomBytes(4096, 42);
+    const auto stored = toBytes("stored without compression");
+
+    AssetPackWriter writer;
+    writer.add("shaders/sprite.vert", compressible);
+    writer.add("textures\\noise.bin", incompressible);
+    writer.add("./fonts/readme.txt", stored, false);
+    writer.add("empty.txt", {});
+    const auto filename = tempPackPath("RoundTrip");
+    writer.write(filename);
+
+    {
+        const auto pack = AssetPack::Open(filename);
+        EXPECT_EQ(pack.getEntryCount(), 4u);
+
+        EXPECT_EQ(pack.read("shaders/sprite.vert"), compressible);
+        // Compressed entries can not be viewed in place
+        EXPECT_FALSE(pack.view("shaders/sprite.vert").has_value());
+
+        EXPECT_EQ(pack.read("textures/noise.bin"), incompressible);
+        const auto noiseView = pack.view("textures/noise.bin");
+        ASSERT_TRUE(noiseView.has_value());
+        EXPECT_EQ(std::vector<char>(noiseView->begin(), noiseView->end()), incompressible);
+
+        EXPECT_EQ(pack.read("fonts/readme.txt"), stored);
+        EXPECT_EQ(pack.read(".\\fonts\\readme.txt"), stored);
+        EXPECT_EQ(pack.read("empty.txt"), std::vector<char>{});
+
+        EXPECT_FALSE(pack.contains("shaders/sprite.frag"));
+        EXPECT_FALSE(pack.read("missing.txt").has_value());
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(AssetPackTest, AddingAPathAgainReplacesTheEntry) {
+    AssetPackWriter writer;
+    writer.add("a.txt", toBytes("first"));
+    writer.add("./a.txt", toBytes("second"));
+    const auto filename = tempPackPath("Replace");
+    writer.write(filename);
+
+    {
+        const auto pack = AssetPack::Open(filename);
+        EXPECT_EQ(pack.getEntryCount(), 1u);
+        EXPECT_EQ(pack.read("a.txt"), toBytes("second"));
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(AssetPackTest, FindsEntriesWhosePathHashesCollide) {
+    // A real 64 bit FNV-1a collision is impractical to find, so the pack is built by hand with an entry in front of
+    // the wanted one which shares its hash but not its path
+    const std::string wanted = "textures/a.png";
+    const std::string impostor = "textures/impostor.png";
+    const std::string other = "z.txt";
+    const auto wantedData = toBytes("wanted");
+    const auto impostorData = toBytes("impostor");
+    const auto otherData = toBytes("other");
+    const uint64_t collidingHash = AssetPack::hashPath(wanted);
+
+    struct RawEntry {
+        std::string path;
+        uint64_t hash;
+        std::vector<char> data;
+    };
+    std::vector<RawEntry> rawEntries{{impostor, collidingHash, impostorData},
+                                     {wanted,   collidingHash, wantedData},
+                                     {other,    AssetPack::hashPath(other), otherData}};
+    std::stable_sort(rawEntries.begin(), rawEntries.end(),
+                     [](const RawEntry &a, const RawEntry &b) { return a.hash < b.hash; });
+
+    std::string pathTable;
+    for (const auto &entry: rawEntries) {
+        pathTable += entry.path;
+    }
+    AssetPack::Header header{};
+    std::memcpy(header.magic, AssetPack::magic, sizeof(header.magic));
+    header.version = AssetPack::version;
+    header.entryCount = static_cast<uint32_t>(rawEntries.size());
+    header.pathTableSize = static_cast<uint32_t>(pathTable.size());
+
+    std::vector<AssetPack::Entry> index;
+    uint64_t dataOffset = sizeof(AssetPack::Header) + rawEntries.size() * sizeof(AssetPack::Entry) + pathTable.size();
+    uint32_t pathOffset = 0;
+    for (const auto &entry: rawEntries) {
+        index.emplace_back(AssetPack::Entry{
+                .pathHash = entry.hash,
+                .offset = dataOffset,
+                .storedSize = entry.data.size(),
+                .size = entry.data.size(),
+                .pathOffset = pathOffset,
+                .pathLength = static_cast<uint16_t>(entry.path.size()),
+                .compression = AssetPack::Compression::None,
+                .reserved = 0,
+        });
+        dataOffset += entry.data.size();
+        pathOffset += static_cast<uint32_t>(entry.path.size());
+    }
+
+    const auto filename = tempPackPath("Collision");
+    {
+        std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+        output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char *>(index.data()),
+                     static_cast<std::streamsize>(index.size() * sizeof(AssetPack::Entry)));
+        output.write(pathTable.data(), static_cast<std::streamsize>(pathTable.size()));
+        for (const auto &entry: rawEntries) {
+            output.write(entry.data.data(), static_cast<std::streamsize>(entry.data.size()));
+        }
+    }
+
+    {
+        const auto pack = AssetPack::Open(filename);
+        EXPECT_EQ(pack.read(wanted), wantedData);
+        EXPECT_EQ(pack.read(other), otherData);
+        // The impostor is only reachable through the hash of the wanted path
+        EXPECT_FALSE(pack.contains(impostor));
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(AssetPackTest, RejectsPathsTooLongForAnEntry) {
+    AssetPackWriter writer;
+    EXPECT_THROW(writer.add(std::string(70000, 'a'), toBytes("data")), std::runtime_error);
+    EXPECT_NO_THROW(writer.add(std::string(1000, 'a'), toBytes("data")));
+}
+
+TEST(AssetPackTest, RejectsFilesWhichAreNoAssetPack) {
+    const auto filename = tempPackPath("Invalid");
+    {
+        std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+        output << "this is not an asset pack at all";
+    }
+    EXPECT_THROW(AssetPack::Open(filename), std::runtime_error);
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/audioSystem/AudioSystem.h"
+#include "Engine/src/core/audioSystem/api/AudioSource.h"
+#include "Engine/src/core/assets/CookedAssets.h"
+#include "Engine/src/core/utils/WorkerPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    class EmptyScene : public Scene {
+    public:
+        SceneConfiguration configure(Engine &) override { return {}; }
+
+        void load() override {}
+
+        void update(float) override {}
+
+        void updateImGui() override {}
+    };
+
+    /// Writes a second of a 440 Hz sine as cooked audio, so AudioBuffer::Create loads it for the returned name
+    std::string writeTone(const std::string &name) {
+        constexpr int sampleRate = 44100;
+        auto *samples = static_cast<short *>(std::malloc(sampleRate * sizeof(short)));
+        for (int i = 0; i < sampleRate; ++i) {
+            samples[i] = static_cast<short>(16000 * std::sin(2.0 * 3.14159265358979 * 440.0 * i / sampleRate));
+        }
+        const RawAudio audio(1, sampleRate, sampleRate, samples);
+
+        const auto source = (std::filesystem::temp_directory_path() / ("ChaosEngineUnitTest_" + name + ".ogg"))
+                .string();
+        const auto cooked = audio.writeCooked();
+        std::ofstream output(CookedAssets::getAudioPath(source), std::ios::binary | std::ios::trunc);
+        output.write(cooked.data(), static_cast<std::streamsize>(cooked.size()));
+        return source;
+    }
+
+    float peak(const std::vector<float> &samples) {
+        float result = 0;
+        for (const float sample: samples) {
+            result = std::max(result, std::abs(sample));
+        }
+        return result;
+    }
+
+    class AudioLoopbackTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            audio.init(scene, AudioBackend::Loopback);
+            ASSERT_NE(AudioSystem::GetAudioThread(), nullptr) << "The loopback device could not be opened";
+            audio.setLoopbackCapture(true);
+            tone = writeTone("Tone");
+        }
+
+        void TearDown() override {
+            std::filesystem::remove(CookedAssets::getAudioPath(tone));
+        }
+
+        /// Runs the audio system like the engine loop, 12000 frames at the loopback sample rate
+        void runFrames(int frames = 10, float deltaTime = 0.025f) {
+            for (int i = 0; i < frames; ++i) {
+                audio.update(ecs, deltaTime);
+            }
+        }
+
+        WorkerPool workers{0};
+        AudioSystem audio{workers};
+        EmptyScene scene;
+        ECS ecs;
+        std::string tone;
+    };
+
+}
+
+TEST_F(AudioLoopbackTest, MixesInLockstepWithTheEngineClock) {
+    runFrames();
+    const auto output = audio.takeLoopbackOutput();
+    EXPECT_EQ(output.size(), 12000u * AudioSystem::loopbackChannels);
+    // Nothing plays, the mix is silent
+    EXPECT_EQ(peak(output), 0.0f);
+    EXPECT_TRUE(audio.takeLoopbackOutput().empty());
+}
+
+TEST_F(AudioLoopbackTest, MixesAPlayingBufferIntoTheOutput) {
+    auto source = AudioSource::Create(glm::vec3(0, 0, 0));
+    source.setBuffer(AudioBuffer::Create(tone));
+    source.play();
+
+    runFrames();
+    const auto output = audio.takeLoopbackOutput();
+    EXPECT_EQ(output.size(), 12000u * AudioSystem::loopbackChannels);
+    EXPECT_GT(peak(output), 0.05f);
+    EXPECT_EQ(source.getState(), AudioSource::State::Playing);
+    EXPECT_FALSE(source.isVirtual());
+
+    // Stopped sources fall silent again
+    source.stop();
+    runFrames(2);
+    audio.takeLoopbackOutput();
+    runFrames();
+    EXPECT_EQ(peak(audio.takeLoopbackOutput()), 0.0f);
+}
+
+TEST_F(AudioLoopbackTest, MixesMoreSourcesThanVoices) {
+    const auto buffer = AudioBuffer::Create(tone);
+    std::vector<AudioSource> sources;
+    const uint32_t count = AudioSystem::GetAudioThread()->getVoiceCount() * 4;
+    for (uint32_t i = 0; i < count; ++i) {
+        sources.emplace_back(AudioSource::Create(glm::vec3(static_cast<float>(i), 0, 0), true));
+        sources.back().setBuffer(buffer);
+        sources.back().play();
+    }
+
+    runFrames();
+    const auto output = audio.takeLoopbackOutput();
+    EXPECT_EQ(output.size(), 12000u * AudioSystem::loopbackChannels);
+    EXPECT_GT(peak(output), 0.05f);
+    // Only the most audible sources own a voice, the others keep playing virtually
+    const auto audible = std::count_if(sources.begin(), sources.end(),
+                                       [](const AudioSource &source) { return !source.isVirtual(); });
+    EXPECT_LE(static_cast<uint32_t>(audible), AudioSystem::GetAudioThread()->getVoiceCount());
+    EXPECT_TRUE(std::all_of(sources.begin(), sources.end(), [](const AudioSource &source) {
+        return source.getState() == AudioSource::State::Playing;
+    }));
+}
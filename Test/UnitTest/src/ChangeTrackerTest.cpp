@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/ChangeTracker.h"
+
+#include <algorithm>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    struct Position {
+        float x;
+    };
+
+    struct Velocity {
+        float x;
+    };
+
+    struct Untracked {
+        int value;
+    };
+
+    template<typename Tracker>
+    std::vector<entt::entity> takeChanges(Tracker &tracker) {
+        std::vector<entt::entity> entities;
+        tracker.each([&entities](entt::entity entity) { entities.push_back(entity); });
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    }
+
+    std::vector<entt::entity> sorted(std::vector<entt::entity> entities) {
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    }
+
+}
+
+TEST(ChangeTrackerTest, MarksEmplacedPatchedAndReplacedEntities) {
+    entt::registry registry;
+    ChangeTracker<Position, Velocity> tracker(registry);
+    const auto a = registry.create(), b = registry.create(), c = registry.create(), d = registry.create();
+    registry.emplace<Position>(a, 1.0f);
+    registry.emplace<Position>(b, 2.0f);
+    registry.emplace<Velocity>(c, 3.0f);
+    registry.emplace<Untracked>(d, 4);
+    EXPECT_EQ(takeChanges(tracker), sorted({a, b, c}));
+    EXPECT_TRUE(tracker.empty());
+
+    registry.patch<Position>(a, [](Position &position) { position.x = 5.0f; });
+    registry.replace<Velocity>(c, 6.0f);
+    registry.emplace_or_replace<Position>(d, 7.0f);
+    registry.patch<Untracked>(d, [](Untracked &untracked) { untracked.value = 8; });
+    // Writes through a reference are not seen
+    registry.get<Position>(b).x = 9.0f;
+    EXPECT_EQ(takeChanges(tracker), sorted({a, c, d}));
+}
+
+TEST(ChangeTrackerTest, RecordsAnEntityOncePerFrame) {
+    entt::registry registry;
+    ChangeTracker<Position, Velocity> tracker(registry);
+    const auto entity = registry.create();
+    registry.emplace<Position>(entity, 1.0f);
+    registry.emplace<Velocity>(entity, 1.0f);
+    registry.patch<Position>(entity, [](Position &position) { position.x = 2.0f; });
+    registry.replace<Velocity>(entity, 2.0f);
+    EXPECT_EQ(tracker.size(), 1u);
+    EXPECT_EQ(takeChanges(tracker), std::vector<entt::entity>{entity});
+
+    // The next frame records it again
+    registry.patch<Position>(entity, [](Position &position) { position.x = 3.0f; });
+    registry.patch<Position>(entity, [](Position &position) { position.x = 4.0f; });
+    EXPECT_EQ(tracker.size(), 1u);
+    tracker.clear();
+    EXPECT_TRUE(tracker.empty());
+    EXPECT_TRUE(takeChanges(tracker).empty());
+}
+
+TEST(ChangeTrackerTest, DoesNotConfuseRecycledEntitiesWithTheirPredecessors) {
+    entt::registry registry;
+    ChangeTracker<Position> tracker(registry);
+    const auto destroyed = registry.create();
+    registry.emplace<Position>(destroyed, 1.0f);
+    registry.destroy(destroyed);
+
+    const auto recycled = registry.create();
+    ASSERT_EQ(entt::to_entity(recycled), entt::to_entity(destroyed));
+    ASSERT_NE(recycled, destroyed);
+    registry.emplace<Position>(recycled, 2.0f);
+    // Both are recorded, the destroyed one is skipped by each
+    EXPECT_EQ(tracker.size(), 2u);
+    EXPECT_EQ(takeChanges(tracker), std::vector<entt::entity>{recycled});
+}
+
+TEST(ChangeTrackerTest, SkipsEntitiesDestroyedAfterTheirChange) {
+    entt::registry registry;
+    ChangeTracker<Position> tracker(registry);
+    const auto kept = registry.create(), destroyed = registry.create();
+    registry.emplace<Position>(kept, 1.0f);
+    registry.emplace<Position>(destroyed, 2.0f);
+    registry.destroy(destroyed);
+    EXPECT_EQ(takeChanges(tracker), std::vector<entt::entity>{kept});
+}
+
+TEST(ChangeTrackerTest, StopsTrackingOnceDestroyed) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    {
+        ChangeTracker<Position> tracker(registry);
+        registry.emplace<Position>(entity, 1.0f);
+        EXPECT_EQ(tracker.size(), 1u);
+    }
+    // The listeners are disconnected, so changes do not reach the destroyed tracker
+    registry.patch<Position>(entity, [](Position &position) { position.x = 2.0f; });
+    ChangeTracker<Position> tracker(registry);
+    EXPECT_TRUE(tracker.empty());
+}
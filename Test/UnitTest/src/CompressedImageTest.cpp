@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/assets/CompressedImage.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    constexpr size_t levelCountOffset = 40;
+    constexpr size_t levelIndexOffset = 80;
+
+    /// 4x2 R8G8B8A8 image with its complete chain of three levels
+    std::vector<char> validFile() {
+        std::vector<std::vector<char>> levels{std::vector<char>(4 * 2 * 4, 1), std::vector<char>(2 * 1 * 4, 2),
+                                              std::vector<char>(1 * 1 * 4, 3)};
+        return CompressedImage::writeKTX2(ImageFormat::R8G8B8A8, 4, 2, levels);
+    }
+
+    template<typename T>
+    void patch(std::vector<char> &data, size_t offset, T value) {
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    std::string writeTempFile(const std::string &name, const std::vector<char> &data) {
+        const auto filename = (std::filesystem::temp_directory_path() / ("ChaosEngineUnitTest_" + name + ".ktx2"))
+                .string();
+        std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+        output.write(data.data(), static_cast<std::streamsize>(data.size()));
+        return filename;
+    }
+
+    void expectRejected(const std::string &name, const std::vector<char> &data) {
+        const auto filename = writeTempFile(name, data);
+        EXPECT_THROW(CompressedImage::readKTX2(filename), std::runtime_error);
+        std::filesystem::remove(filename);
+    }
+
+}
+
+TEST(CompressedImageTest, ReadsTheLevelsWrittenByTheCooker) {
+    const auto filename = writeTempFile("Valid", validFile());
+    {
+        const auto image = CompressedImage::readKTX2(filename);
+        ASSERT_EQ(image.getLevels().size(), 3u);
+        EXPECT_EQ(image.getFormat(), ImageFormat::R8G8B8A8);
+        EXPECT_EQ(image.getWidth(), 4u);
+        EXPECT_EQ(image.getHeight(), 2u);
+        EXPECT_EQ(image.getLevels()[2].width, 1u);
+        EXPECT_EQ(image.getData()[image.getLevels()[1].offset], 2);
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(CompressedImageTest, RejectsMoreLevelsThanTheImageSizeAllows) {
+    auto data = validFile();
+    patch<uint32_t>(data, levelCountOffset, 4);
+    // Large enough for the level index, so only the level count can reject it
+    data.resize(data.size() + 4096, 0);
+    expectRejected("FourLevels", data);
+
+    patch<uint32_t>(data, levelCountOffset, 40);
+    expectRejected("FortyLevels", data);
+}
+
+TEST(CompressedImageTest, RejectsFilesWithoutStoredLevels) {
+    auto data = validFile();
+    patch<uint32_t>(data, levelCountOffset, 0);
+    expectRejected("NoLevels", data);
+}
+
+TEST(CompressedImageTest, RejectsLevelsWhoseEndWrapsAround) {
+    auto data = validFile();
+    // offset + size wraps to a small value
+    patch<uint64_t>(data, levelIndexOffset, ~uint64_t{0} - 15);
+    patch<uint64_t>(data, levelIndexOffset + 8, 32);
+    expectRejected("WrappingLevel", data);
+}
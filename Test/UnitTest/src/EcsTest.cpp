@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/Ecs.h"
+#include "Engine/src/core/Components.h"
+
+#include <algorithm>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    std::vector<entt::entity> childrenOf(const entt::registry &registry, entt::entity parent) {
+        std::vector<entt::entity> children;
+        if (const auto *list = registry.try_get<ChildrenComponent>(parent)) {
+            for (auto child = list->first; child != entt::null;
+                 child = registry.get<ParentComponent>(child).nextSibling) {
+                children.push_back(child);
+            }
+        }
+        std::sort(children.begin(), children.end());
+        return children;
+    }
+
+    std::vector<entt::entity> sorted(std::vector<entt::entity> entities) {
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    }
+
+}
+
+TEST(EcsTest, RemovingAnEntityRemovesItsSubtreeOnly) {
+    ECS ecs;
+    auto &registry = ecs.getRegistry();
+    const auto entities = ecs.addEntities<>(5);
+    const auto root = entities[0], child = entities[1], grandChild = entities[2], sibling = entities[3];
+    ecs.getEntity(child).setParent(ecs.getEntity(root));
+    ecs.getEntity(grandChild).setParent(ecs.getEntity(child));
+    ecs.getEntity(sibling).setParent(ecs.getEntity(root));
+
+    ecs.removeEntity(child);
+
+    EXPECT_FALSE(registry.valid(child));
+    EXPECT_FALSE(registry.valid(grandChild));
+    EXPECT_TRUE(registry.valid(root));
+    EXPECT_TRUE(registry.valid(sibling));
+    EXPECT_TRUE(registry.valid(entities[4]));
+    EXPECT_EQ(childrenOf(registry, root), std::vector<entt::entity>{sibling});
+}
+
+TEST(EcsTest, RemovingEntitiesTogetherWithTheirAncestorsRemovesEachOnce) {
+    ECS ecs;
+    auto &registry = ecs.getRegistry();
+    const auto entities = ecs.addEntities<>(3);
+    const auto root = entities[0], child = entities[1], grandChild = entities[2];
+    ecs.getEntity(child).setParent(ecs.getEntity(root));
+    ecs.getEntity(grandChild).setParent(ecs.getEntity(child));
+
+    ecs.removeEntities({grandChild, root, child, root});
+
+    EXPECT_FALSE(registry.valid(root));
+    EXPECT_FALSE(registry.valid(child));
+    EXPECT_FALSE(registry.valid(grandChild));
+}
+
+TEST(EcsTest, ReparentingMovesTheEntityBetweenChildLists) {
+    ECS ecs;
+    auto &registry = ecs.getRegistry();
+    const auto entities = ecs.addEntities<>(5);
+    const auto first = entities[0], second = entities[1], a = entities[2], b = entities[3], c = entities[4];
+    for (const auto child: {a, b, c}) {
+        ecs.getEntity(child).setParent(ecs.getEntity(first));
+    }
+
+    ecs.getEntity(b).setParent(ecs.getEntity(second));
+    EXPECT_EQ(childrenOf(registry, first), sorted({a, c}));
+    EXPECT_EQ(childrenOf(registry, second), std::vector<entt::entity>{b});
+
+    ecs.getEntity(a).removeParent();
+    // Destroying a child directly on the registry unlinks it as well
+    registry.destroy(c);
+    EXPECT_TRUE(childrenOf(registry, first).empty());
+
+    ecs.removeEntity(first);
+    EXPECT_TRUE(registry.valid(a));
+    EXPECT_TRUE(registry.valid(b));
+}
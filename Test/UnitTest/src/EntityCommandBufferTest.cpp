@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/Ecs.h"
+#include "Engine/src/core/EntityCommandBuffer.h"
+
+using namespace ChaosEngine;
+
+namespace {
+
+    struct Health {
+        int value;
+    };
+
+}
+
+TEST(EntityCommandBufferTest, AppliesCommandsOfDeferredEntities) {
+    ECS ecs;
+    auto &registry = ecs.getRegistry();
+    const auto existing = ecs.addEntities<>(2);
+    EntityCommandBuffer buffer;
+
+    const auto deferred = buffer.createEntity();
+    buffer.setComponent<Health>(deferred, Health{3});
+    buffer.setComponent<Health>(existing[0], Health{5});
+    buffer.destroyEntity(existing[1]);
+    EXPECT_FALSE(buffer.empty());
+    EXPECT_EQ(registry.size<Health>(), 0u);
+
+    buffer.apply(ecs);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(registry.valid(existing[1]));
+    EXPECT_EQ(registry.get<Health>(existing[0]).value, 5);
+    int deferredHealth = 0;
+    for (const auto [entity, health]: registry.view<const Health>().each()) {
+        if (entity != existing[0])
+            deferredHealth = health.value;
+    }
+    EXPECT_EQ(deferredHealth, 3);
+}
+
+TEST(EntityCommandBufferTest, DeferredEntitiesExpireWithTheApply) {
+    ECS ecs;
+    EntityCommandBuffer buffer;
+    const auto stale = buffer.createEntity();
+    buffer.apply(ecs);
+    // The next frame defers an entity with the same index, which the stale one must not alias
+    const auto fresh = buffer.createEntity();
+    EXPECT_EQ(fresh.index, stale.index);
+    buffer.setComponent<Health>(fresh, Health{1});
+    EXPECT_DEBUG_DEATH(buffer.setComponent<Health>(stale, Health{2}), "Deferred entity was created before");
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/Components.h"
+#include "Engine/src/core/renderSystem/ModelMatrixBatch.h"
+#include "Engine/src/core/renderSystem/ModelMatrixKernels.h"
+
+#include <random>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    std::vector<Transform> randomTransforms(size_t count, uint32_t seed) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+        std::uniform_real_distribution<float> rotation(-1080.0f, 1080.0f);
+        std::uniform_real_distribution<float> scale(-4.0f, 4.0f);
+        std::vector<Transform> transforms;
+        transforms.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            transforms.emplace_back(Transform{
+                    glm::vec3(position(random), position(random), position(random)),
+                    glm::vec3(rotation(random), rotation(random), rotation(random)),
+                    glm::vec3(scale(random), scale(random), scale(random)),
+            });
+        }
+        return transforms;
+    }
+
+    /// Rotations on and around the quadrant boundaries of the sine and cosine kernel
+    std::vector<Transform> boundaryTransforms() {
+        std::vector<Transform> transforms;
+        for (float angle = -720.0f; angle <= 720.0f; angle += 45.0f) {
+            for (const float offset: {-0.001f, 0.0f, 0.001f}) {
+                transforms.emplace_back(Transform{glm::vec3(1, 2, 3), glm::vec3(0, 0, angle + offset), glm::vec3(1)});
+                transforms.emplace_back(Transform{glm::vec3(0), glm::vec3(angle + offset, 30, angle), glm::vec3(2)});
+            }
+        }
+        return transforms;
+    }
+
+    void expectMatchesModelMatrix(const Transform &transform, const GLMCustomExtension::Affine2D &matrix) {
+        const glm::mat4 reference = transform.getModelMatrix();
+        const float tolerance = 2e-5f * std::max({1.0f, std::abs(transform.scale.x), std::abs(transform.scale.y)});
+        EXPECT_NEAR(matrix.linear.x, reference[0][0], tolerance);
+        EXPECT_NEAR(matrix.linear.y, reference[0][1], tolerance);
+        EXPECT_NEAR(matrix.linear.z, reference[1][0], tolerance);
+        EXPECT_NEAR(matrix.linear.w, reference[1][1], tolerance);
+        EXPECT_FLOAT_EQ(matrix.translation.x, reference[3][0]);
+        EXPECT_FLOAT_EQ(matrix.translation.y, reference[3][1]);
+        EXPECT_FLOAT_EQ(matrix.translation.z, reference[3][2]);
+    }
+
+    /// Runs the kernel directly, one lane width at a time
+    template<typename Lanes>
+    std::vector<GLMCustomExtension::Affine2D> computeWithLanes(const std::vector<Transform> &transforms) {
+        const size_t padded = (transforms.size() + Lanes::width - 1) / Lanes::width * Lanes::width;
+        std::array<std::vector<float>, 8> components;
+        for (auto &component: components)
+            component.resize(padded, 0.0f);
+        for (size_t i = 0; i < transforms.size(); ++i) {
+            const auto &transform = transforms[i];
+            components[0][i] = transform.position.x;
+            components[1][i] = transform.position.y;
+            components[2][i] = transform.position.z;
+            components[3][i] = transform.rotation.x;
+            components[4][i] = transform.rotation.y;
+            components[5][i] = transform.rotation.z;
+            components[6][i] = transform.scale.x;
+            components[7][i] = transform.scale.y;
+        }
+
+        std::vector<GLMCustomExtension::Affine2D> matrices(transforms.size());
+        float out[7][Lanes::width];
+        for (size_t first = 0; first < transforms.size(); first += Lanes::width) {
+            std::array<const float *, 8> in{};
+            for (size_t c = 0; c < in.size(); ++c)
+                in[c] = components[c].data() + first;
+            ModelMatrixKernels::computeModelMatrices<Lanes>(in, out);
+            for (size_t lane = 0; lane < Lanes::width && first + lane < transforms.size(); ++lane) {
+                matrices[first + lane].linear = glm::vec4(out[0][lane], out[1][lane], out[2][lane], out[3][lane]);
+                matrices[first + lane].translation = glm::vec4(out[4][lane], out[5][lane], out[6][lane], 0);
+            }
+        }
+        return matrices;
+    }
+
+}
+
+template<typename Lanes>
+class ModelMatrixKernelTest : public ::testing::Test {
+};
+
+using LaneTypes = ::testing::Types<ModelMatrixKernels::ScalarLanes
+#if defined(CHAOS_MODEL_MATRIX_SSE2)
+        , ModelMatrixKernels::SSE2Lanes
+#endif
+#if defined(__AVX__)
+        , ModelMatrixKernels::AVXLanes
+#endif
+>;
+TYPED_TEST_SUITE(ModelMatrixKernelTest, LaneTypes);
+
+TYPED_TEST(ModelMatrixKernelTest, MatchesTransformModelMatrixForRandomTransforms) {
+    const auto transforms = randomTransforms(TypeParam::width * 256 + 3, 1337);
+    const auto matrices = computeWithLanes<TypeParam>(transforms);
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        SCOPED_TRACE("Transform " + std::to_string(i));
+        expectMatchesModelMatrix(transforms[i], matrices[i]);
+    }
+}
+
+TYPED_TEST(ModelMatrixKernelTest, MatchesTransformModelMatrixAtQuadrantBoundaries) {
+    const auto transforms = boundaryTransforms();
+    const auto matrices = computeWithLanes<TypeParam>(transforms);
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        SCOPED_TRACE("Transform " + std::to_string(i));
+        expectMatchesModelMatrix(transforms[i], matrices[i]);
+    }
+}
+
+TEST(ModelMatrixBatchTest, FlushWritesEveryScheduledTarget) {
+    // Counts around the lane width exercise the padding of the last batch
+    for (const size_t count: {1u, 7u, 8u, 9u, 33u}) {
+        const auto transforms = randomTransforms(count, static_cast<uint32_t>(count));
+        std::vector<GLMCustomExtension::Affine2D> targets(count);
+        ModelMatrixBatch batch;
+        for (size_t i = 0; i < count; ++i) {
+            batch.push(transforms[i], targets[i]);
+        }
+        EXPECT_EQ(batch.size(), count);
+        batch.flush();
+        EXPECT_EQ(batch.size(), 0u);
+        for (size_t i = 0; i < count; ++i) {
+            SCOPED_TRACE("Transform " + std::to_string(i) + " of " + std::to_string(count));
+            expectMatchesModelMatrix(transforms[i], targets[i]);
+        }
+    }
+}
+
+TEST(ModelMatrixBatchTest, UpdateOnlySchedulesChangedTransforms) {
+    ModelMatrixBatch batch;
+    ModelMatrixCache cache;
+    Transform transform{glm::vec3(1, 2, 0), glm::vec3(0, 0, 30), glm::vec3(2, 3, 1)};
+
+    EXPECT_TRUE(batch.update(cache, transform));
+    batch.flush();
+    expectMatchesModelMatrix(transform, cache.matrix);
+
+    EXPECT_FALSE(batch.update(cache, transform));
+    EXPECT_EQ(batch.size(), 0u);
+
+    transform.rotation.z = 60;
+    EXPECT_TRUE(batch.update(cache, transform));
+    batch.flush();
+    expectMatchesModelMatrix(transform, cache.matrix);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/scriptSystem/NativeScriptSystem.h"
+#include "Engine/src/core/scriptSystem/NativeScript.h"
+#include "Engine/src/core/utils/WorkerPool.h"
+#include "Engine/src/core/Scene.h"
+#include "Engine/src/core/Components.h"
+
+#include <memory>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    struct Position {
+        float x;
+    };
+
+    struct Velocity {
+        float x;
+    };
+
+    struct Health {
+        int value;
+    };
+
+    class EmptyScene : public Scene {
+    public:
+        SceneConfiguration configure(Engine &) override { return {}; }
+
+        void load() override {}
+
+        void update(float) override {}
+
+        void updateImGui() override {}
+    };
+
+    /// Declares the access it is given and records how it was updated
+    class AccessScript : public NativeScript {
+    public:
+        explicit AccessScript(Entity entity = {}) : NativeScript(entity) {}
+
+        template<typename... Component>
+        AccessScript &access() {
+            declareAccess<Component...>();
+            return *this;
+        }
+
+        template<typename... Component>
+        AccessScript &sharedReads() {
+            declareSharedReads<Component...>();
+            return *this;
+        }
+
+        void onUpdate(float) override {
+            ++updates;
+            updatedInParallel = isRunningInParallel();
+        }
+
+        int updates = 0;
+        bool updatedInParallel = false;
+    };
+
+    /// Adds a script to a new entity of the scene, the script stays owned by its NativeScriptComponent
+    AccessScript &addScript(Scene &scene, bool active = true) {
+        auto entity = scene.createEntity();
+        auto script = std::make_unique<AccessScript>(entity);
+        auto &result = *script;
+        entity.setComponent<NativeScriptComponent>(std::move(script), active);
+        return result;
+    }
+
+}
+
+TEST(NativeScriptSystemTest, KeepsScriptsWithoutConflictsParallel) {
+    AccessScript writer, reader, otherWriter;
+    writer.access<Position>();
+    // Reading a component of its own entity never conflicts, every entity has one script
+    reader.access<const Position>().sharedReads<Health>();
+    otherWriter.access<Velocity>();
+    AccessScript serial;
+
+    std::vector<NativeScript *> parallelScripts{&writer, &reader, &otherWriter};
+    std::vector<NativeScript *> serialScripts{&serial};
+    NativeScriptSystem::resolveConflicts(parallelScripts, serialScripts);
+
+    EXPECT_EQ(parallelScripts, (std::vector<NativeScript *>{&writer, &reader, &otherWriter}));
+    EXPECT_EQ(serialScripts, std::vector<NativeScript *>{&serial});
+}
+
+TEST(NativeScriptSystemTest, MovesScriptsReadingParallelWritesToTheSerialOnes) {
+    AccessScript positionWriter, positionReader, velocityWriter, velocityReader, serial;
+    positionWriter.access<Position>();
+    positionReader.access<const Health>().sharedReads<Position>();
+    velocityWriter.access<Velocity>().sharedReads<Health>();
+    velocityReader.access<Health>().sharedReads<Health, Velocity>();
+
+    std::vector<NativeScript *> parallelScripts{&positionWriter, &positionReader, &velocityWriter, &velocityReader};
+    std::vector<NativeScript *> serialScripts{&serial};
+    NativeScriptSystem::resolveConflicts(parallelScripts, serialScripts);
+
+    // Both keep their order, the moved scripts run after the serial ones
+    EXPECT_EQ(parallelScripts, (std::vector<NativeScript *>{&positionWriter}));
+    EXPECT_EQ(serialScripts, (std::vector<NativeScript *>{&serial, &positionReader, &velocityWriter, &velocityReader}));
+}
+
+TEST(NativeScriptSystemTest, MovesScriptsReadingTheirOwnWritesOfOtherEntities) {
+    AccessScript script;
+    script.access<Position>().sharedReads<Position>();
+
+    std::vector<NativeScript *> parallelScripts{&script};
+    std::vector<NativeScript *> serialScripts;
+    NativeScriptSystem::resolveConflicts(parallelScripts, serialScripts);
+
+    EXPECT_TRUE(parallelScripts.empty());
+    EXPECT_EQ(serialScripts, std::vector<NativeScript *>{&script});
+}
+
+TEST(NativeScriptSystemTest, RunsOnlyScriptsWithDeclaredAccessInParallel) {
+    WorkerPool workers(2);
+    NativeScriptSystem system(workers);
+    EmptyScene scene;
+
+    auto &declared = addScript(scene).access<Position>();
+    auto &undeclared = addScript(scene);
+    auto &conflicting = addScript(scene).access<const Velocity>().sharedReads<Position>();
+    auto &inactive = addScript(scene, false).access<Velocity>();
+
+    system.update(scene, 0.016f);
+
+    EXPECT_EQ(declared.updates, 1);
+    EXPECT_TRUE(declared.updatedInParallel);
+    EXPECT_EQ(undeclared.updates, 1);
+    EXPECT_FALSE(undeclared.updatedInParallel);
+    EXPECT_EQ(conflicting.updates, 1);
+    EXPECT_FALSE(conflicting.updatedInParallel);
+    EXPECT_EQ(inactive.updates, 0);
+    EXPECT_FALSE(NativeScript::isRunningInParallel());
+}
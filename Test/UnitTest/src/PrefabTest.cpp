@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/Components.h"
+#include "Engine/src/core/Ecs.h"
+#include "Engine/src/core/Prefab.h"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    struct TileKind {
+        int kind;
+    };
+
+    /// Created per instance from the Transform, like a rigid body would be
+    struct Cell {
+        int x;
+        int y;
+    };
+
+}
+
+TEST(PrefabTest, InstantiatesOneInstancePerValue) {
+    constexpr size_t tileCount = 100000;
+    constexpr int levelWidth = 400;
+    std::vector<Transform> transforms;
+    transforms.reserve(tileCount);
+    for (size_t i = 0; i < tileCount; ++i) {
+        const auto x = static_cast<float>(i % levelWidth), y = static_cast<float>(i / levelWidth);
+        transforms.emplace_back(Transform{glm::vec3(x, y, 0), glm::vec3(0), glm::vec3(1)});
+    }
+
+    Prefab tile;
+    tile.set(TileKind{7});
+    tile.setFactory<Cell>([](Entity entity) {
+        // Per instance values are added before the factories run
+        const auto &transform = entity.get<Transform>();
+        return Cell{static_cast<int>(transform.position.x), static_cast<int>(transform.position.y)};
+    });
+
+    ECS ecs;
+    const auto start = std::chrono::steady_clock::now();
+    const auto entities = tile.instantiate(ecs, transforms);
+    const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    RecordProperty("InstantiateMilliseconds", std::to_string(duration.count()));
+    std::printf("Instantiated %zu tiles in %.2f ms\n", tileCount, duration.count());
+
+    ASSERT_EQ(entities.size(), tileCount);
+    auto &registry = ecs.getRegistry();
+    for (size_t i = 0; i < tileCount; ++i) {
+        const auto entity = entities[i];
+        ASSERT_TRUE(registry.valid(entity));
+        ASSERT_EQ(registry.get<Transform>(entity), transforms[i]);
+        ASSERT_EQ(registry.get<TileKind>(entity).kind, 7);
+        const auto &cell = registry.get<Cell>(entity);
+        ASSERT_EQ(cell.x, static_cast<int>(i % levelWidth));
+        ASSERT_EQ(cell.y, static_cast<int>(i / levelWidth));
+    }
+}
+
+TEST(PrefabTest, InstantiatesCountCopiesOfThePrefab) {
+    Prefab prefab;
+    prefab.set(TileKind{3}).set(Transform{glm::vec3(1, 2, 3), glm::vec3(0), glm::vec3(1)});
+
+    ECS ecs;
+    const auto entities = prefab.instantiate(ecs, 1000);
+    ASSERT_EQ(entities.size(), 1000u);
+    for (const auto entity: entities) {
+        EXPECT_EQ(ecs.getRegistry().get<TileKind>(entity).kind, 3);
+        EXPECT_EQ(ecs.getRegistry().get<Transform>(entity).position, glm::vec3(1, 2, 3));
+    }
+
+    // Removing a component from the prefab only affects later instances
+    prefab.remove<TileKind>();
+    const auto later = prefab.instantiate(ecs, 1);
+    EXPECT_FALSE(ecs.getRegistry().all_of<TileKind>(later[0]));
+    EXPECT_TRUE(ecs.getRegistry().all_of<TileKind>(entities[0]));
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/utils/SPSCQueue.h"
+
+#include <memory>
+#include <thread>
+
+using namespace ChaosEngine;
+
+TEST(SPSCQueueTest, RoundsTheCapacityUpAndKeepsOneSlotFree) {
+    SPSCQueue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 7u);
+
+    for (int i = 0; i < 7; ++i) {
+        EXPECT_TRUE(queue.tryPush(int{i}));
+    }
+    int rejected = 7;
+    EXPECT_FALSE(queue.tryPush(std::move(rejected)));
+
+    int value = -1;
+    for (int i = 0; i < 7; ++i) {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(SPSCQueueTest, WrapsAroundTheEnd) {
+    SPSCQueue<int> queue(3);
+    int value = -1;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(queue.tryPush(int{i}));
+        ASSERT_TRUE(queue.tryPush(int{i + 1000}));
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i + 1000);
+    }
+}
+
+TEST(SPSCQueueTest, RejectedPushLeavesTheValueUntouched) {
+    SPSCQueue<std::unique_ptr<int>> queue(1);
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(1)));
+    auto second = std::make_unique<int>(2);
+    EXPECT_FALSE(queue.tryPush(std::move(second)));
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(*second, 2);
+}
+
+TEST(SPSCQueueTest, PopReleasesTheSlot) {
+    SPSCQueue<std::shared_ptr<int>> queue(4);
+    auto shared = std::make_shared<int>(1);
+    EXPECT_TRUE(queue.tryPush(std::shared_ptr<int>(shared)));
+    std::shared_ptr<int> popped;
+    ASSERT_TRUE(queue.tryPop(popped));
+    popped.reset();
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(SPSCQueueTest, DeliversEveryValueInOrderAcrossThreads) {
+    constexpr uint32_t valueCount = 1'000'000;
+    SPSCQueue<uint32_t> queue(64);
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < valueCount; ++i) {
+            while (!queue.tryPush(uint32_t{i})) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    uint32_t outOfOrder = 0;
+    uint32_t value = 0;
+    while (expected < valueCount) {
+        if (!queue.tryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (value != expected)
+            ++outOfOrder;
+        ++expected;
+    }
+    producer.join();
+
+    EXPECT_EQ(outOfOrder, 0u);
+    EXPECT_FALSE(queue.tryPop(value));
+}
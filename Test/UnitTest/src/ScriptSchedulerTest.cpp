@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/scriptSystem/ScriptScheduler.h"
+
+#include <future>
+
+using namespace ChaosEngine;
+
+namespace {
+
+    /// Sets the flag when the coroutine frame holding it is destroyed
+    struct DestructionGuard {
+        bool &destroyed;
+
+        ~DestructionGuard() { destroyed = true; }
+    };
+
+    ScriptCoroutine countFrames(int &frames, int count) {
+        for (int i = 0; i < count; ++i) {
+            ++frames;
+            co_await NextFrameAwaitable{};
+        }
+        ++frames;
+    }
+
+    ScriptCoroutine waitThenSet(float seconds, bool &done, bool &destroyed) {
+        DestructionGuard guard{destroyed};
+        co_await DelayAwaitable{seconds};
+        done = true;
+    }
+
+    ScriptCoroutine waitUntilThenSet(const bool &condition, bool &done, bool &destroyed) {
+        DestructionGuard guard{destroyed};
+        co_await ConditionAwaitable([&condition]() { return condition; });
+        done = true;
+    }
+
+    ScriptCoroutine waitForValue(std::shared_future<int> future, int &value) {
+        value = co_await FutureAwaitable<int>(std::move(future));
+    }
+
+    /// Advances the scheduler in steps until the time passed
+    void advance(ScriptScheduler &scheduler, float seconds, float step = 0.05f) {
+        for (float time = 0.0f; time < seconds - step * 0.5f; time += step) {
+            scheduler.update(step);
+        }
+    }
+
+}
+
+TEST(ScriptSchedulerTest, ResumesNextFrameCoroutinesOncePerUpdate) {
+    ScriptScheduler scheduler;
+    const auto lifetime = std::make_shared<ScriptLifetime>();
+    int frames = 0;
+
+    countFrames(frames, 3).start(scheduler, lifetime);
+    // Runs until the first suspension when started
+    EXPECT_EQ(frames, 1);
+    EXPECT_EQ(scheduler.size(), 1u);
+
+    // A coroutine suspending again while resumed waits for the next update
+    scheduler.update(0.0f);
+    EXPECT_EQ(frames, 2);
+    scheduler.update(0.0f);
+    EXPECT_EQ(frames, 3);
+    scheduler.update(0.0f);
+    EXPECT_EQ(frames, 4);
+    EXPECT_EQ(scheduler.size(), 0u);
+}
+
+TEST(ScriptSchedulerTest, ResumesDelaysInTheFirstUpdateAfterThem) {
+    ScriptScheduler scheduler;
+    const auto lifetime = std::make_shared<ScriptLifetime>();
+    bool done = false, destroyed = false;
+
+    waitThenSet(0.5f, done, destroyed).start(scheduler, lifetime);
+    advance(scheduler, 0.45f);
+    EXPECT_FALSE(done);
+    advance(scheduler, 0.1f);
+    EXPECT_TRUE(done);
+    EXPECT_TRUE(destroyed);
+    EXPECT_EQ(scheduler.size(), 0u);
+}
+
+TEST(ScriptSchedulerTest, NeverResumesDelaysInTheUpdateTheyWereScheduledIn) {
+    ScriptScheduler scheduler;
+    const auto lifetime = std::make_shared<ScriptLifetime>();
+    bool done = false, destroyed = false;
+
+    waitThenSet(0.0f, done, destroyed).start(scheduler, lifetime);
+    EXPECT_FALSE(done);
+    // Without time passing no tick is due
+    scheduler.update(0.0f);
+    EXPECT_FALSE(done);
+    scheduler.update(ScriptScheduler::tickDuration);
+    EXPECT_TRUE(done);
+}
+
+TEST(ScriptSchedulerTest, ResumesDelaysLongerThanOneRevolutionOfTheWheel) {
+    ScriptScheduler scheduler;
+    const auto lifetime = std::make_shared<ScriptLifetime>();
+    const float revolution = ScriptScheduler::slotCount * ScriptScheduler::tickDuration;
+    bool shortDone = false, longDone = false, longerDone = false, destroyed = false;
+
+    // All three share a slot of the wheel and only differ in the remaining revolutions
+    waitThenSet(0.5f, shortDone, destroyed).start(scheduler, lifetime);
+    waitThenSet(0.5f + revolution, longDone, destroyed).start(scheduler, lifetime);
+    waitThenSet(0.5f + 2 * revolution, longerDone, destroyed).start(scheduler, lifetime);
+    EXPECT_EQ(scheduler.size(), 3u);
+
+    advance(scheduler, 0.6f);
+    EXPECT_TRUE(shortDone);
+    EXPECT_FALSE(longDone);
+    EXPECT_FALSE(longerDone);
+
+    advance(scheduler, revolution - 0.2f);
+    EXPECT_FALSE(longDone);
+    advance(scheduler, 0.2f);
+    EXPECT_TRUE(longDone);
+    EXPECT_FALSE(longerDone);
+
+    advance(scheduler, revolution);
+    EXPECT_TRUE(longerDone);
+    EXPECT_EQ(scheduler.size(), 0u);
+}
+
+TEST(ScriptSchedulerTest, ResumesConditionsInTheFirstUpdateTheyHold) {
+    ScriptScheduler scheduler;
+    const auto lifetime = std::make_shared<ScriptLifetime>();
+    bool condition = false, done = false, destroyed = false;
+
+    waitUntilThenSet(condition, done, destroyed).start(scheduler, lifetime);
+    scheduler.update(1.0f);
+    scheduler.update(1.0f);
+    EXPECT_FALSE(done);
+    EXPECT_EQ(scheduler.size(), 1u);
+
+    condition = true;
+    scheduler.update(0.0f);
+    EXPECT_TRUE(done);
+    EXPECT_EQ(scheduler.size(), 0u);
+}
+
+TEST(ScriptSchedulerTest, ReturnsTheValueOfAwaitedFutures) {
+    ScriptScheduler scheduler;
+    const auto lifetime = std::make_shared<ScriptLifetime>();
+    std::promise<int> promise;
+    int value = 0;
+
+    waitForValue(promise.get_future().share(), value).start(scheduler, lifetime);
+    scheduler.update(0.1f);
+    EXPECT_EQ(value, 0);
+
+    promise.set_value(42);
+    scheduler.update(0.1f);
+    EXPECT_EQ(value, 42);
+    EXPECT_EQ(scheduler.size(), 0u);
+}
+
+TEST(ScriptSchedulerTest, DestroysCoroutinesOfDeadScriptsInsteadOfResumingThem) {
+    ScriptScheduler scheduler;
+    auto lifetime = std::make_shared<ScriptLifetime>();
+    bool condition = false;
+    bool delayDone = false, delayDestroyed = false;
+    bool conditionDone = false, conditionDestroyed = false;
+
+    waitThenSet(0.1f, delayDone, delayDestroyed).start(scheduler, lifetime);
+    waitUntilThenSet(condition, conditionDone, conditionDestroyed).start(scheduler, lifetime);
+    lifetime.reset();
+
+    advance(scheduler, 0.2f);
+    EXPECT_FALSE(delayDone);
+    EXPECT_TRUE(delayDestroyed);
+    EXPECT_FALSE(conditionDone);
+    EXPECT_TRUE(conditionDestroyed);
+    EXPECT_EQ(scheduler.size(), 0u);
+}
+
+TEST(ScriptSchedulerTest, ClearDestroysAllSuspendedCoroutines) {
+    ScriptScheduler scheduler;
+    const auto lifetime = std::make_shared<ScriptLifetime>();
+    bool condition = false;
+    bool delayDone = false, delayDestroyed = false;
+    bool conditionDone = false, conditionDestroyed = false;
+    int frames = 0;
+
+    waitThenSet(10.0f, delayDone, delayDestroyed).start(scheduler, lifetime);
+    waitUntilThenSet(condition, conditionDone, conditionDestroyed).start(scheduler, lifetime);
+    countFrames(frames, 5).start(scheduler, lifetime);
+    EXPECT_EQ(scheduler.size(), 3u);
+
+    scheduler.clear();
+    EXPECT_EQ(scheduler.size(), 0u);
+    EXPECT_TRUE(delayDestroyed);
+    EXPECT_TRUE(conditionDestroyed);
+
+    condition = true;
+    advance(scheduler, 11.0f, 0.5f);
+    EXPECT_FALSE(delayDone);
+    EXPECT_FALSE(conditionDone);
+    EXPECT_EQ(frames, 1);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/utils/WorkerPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ChaosEngine;
+
+TEST(WorkerPoolTest, VisitsEveryIndexExactlyOnce) {
+    WorkerPool workers(3);
+    for (const size_t count: {1u, 7u, 64u, 1000u, 1001u}) {
+        for (const size_t chunkSize: {0u, 1u, 3u, 64u, 5000u}) {
+            std::vector<std::atomic<uint32_t>> visits(count);
+            workers.parallelFor(count, chunkSize, [&](size_t begin, size_t end) {
+                ASSERT_LT(begin, end);
+                ASSERT_LE(end, count);
+                for (size_t i = begin; i < end; ++i) {
+                    visits[i].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+            for (size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(visits[i].load(), 1u) << "Index " << i << " of " << count << " with chunks of " << chunkSize;
+            }
+        }
+    }
+}
+
+TEST(WorkerPoolTest, EmptyLoopDoesNotCallTheFunction) {
+    WorkerPool workers(2);
+    bool called = false;
+    workers.parallelFor(0, 16, [&](size_t, size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(WorkerPoolTest, PoolWithoutWorkersRunsOnTheCallingThread) {
+    WorkerPool workers(0);
+    EXPECT_EQ(workers.getWorkerCount(), 0u);
+    const auto caller = std::this_thread::get_id();
+    size_t processed = 0;
+    workers.parallelFor(100, 10, [&](size_t begin, size_t end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        processed += end - begin;
+    });
+    EXPECT_EQ(processed, 100u);
+}
+
+TEST(WorkerPoolTest, ReturnsOnlyOnceAllChunksAreDone) {
+    WorkerPool workers(4);
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        std::atomic<size_t> processed = 0;
+        workers.parallelFor(256, 4, [&](size_t begin, size_t end) {
+            if (begin % 64 == 0)
+                std::this_thread::yield();
+            processed.fetch_add(end - begin, std::memory_order_relaxed);
+        });
+        ASSERT_EQ(processed.load(), 256u) << "Iteration " << iteration;
+    }
+}
+
+TEST(WorkerPoolTest, ChunksRunOnWorkersAndTheCaller) {
+    WorkerPool workers(2);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    // Chunks which wait for each other force all participants to take one
+    std::atomic<uint32_t> started = 0;
+    workers.parallelFor(3, 1, [&](size_t, size_t) {
+        started.fetch_add(1);
+        while (started.load() < 3) {
+            std::this_thread::yield();
+        }
+        std::lock_guard lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+    EXPECT_EQ(threads.size(), 3u);
+    EXPECT_TRUE(threads.contains(std::this_thread::get_id()));
+}
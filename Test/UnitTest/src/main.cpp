@@ -0,0 +1,9 @@
+#include <gtest/gtest.h>
+
+#include "Engine/src/core/utils/Logger.h"
+
+int main(int argc, char **argv) {
+    Logger::Init(LogLevel::Warn);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}